@@ -0,0 +1,59 @@
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/map.hpp"
+
+namespace {
+	class sumOfValues {
+	public:
+		using value_type = long long;
+
+		static long long identity() {
+			return 0;
+		}
+		static long long lift(const std::pair<int, int> &value) {
+			return value.second;
+		}
+		static long long combine(long long left, long long right) {
+			return left + right;
+		}
+	};
+}
+
+void benchmarkAggregate() {
+	const int COUNT = 1000000;
+	const int QUERY_COUNT = 10000;
+
+	std::vector<std::pair<int, int>> sorted(COUNT);
+	for (int i = 0; i < COUNT; i++)
+		sorted[i] = std::make_pair(i, i % 100);
+
+	std::mt19937 random(42);
+	std::vector<std::pair<int, int>> ranges(QUERY_COUNT);
+	for (auto &range : ranges) {
+		int lower = random() % COUNT;
+		range = std::make_pair(lower, lower + static_cast<int>(random() % 10000));
+	}
+
+	bon::map<int, int> plainMap(bon::sorted_unique, sorted.begin(), sorted.end());
+	bon::map<int, int, std::less<int>, bon::pool_allocator<std::pair<int, int>>, bon::monoid_augment<sumOfValues>> summedMap(bon::sorted_unique, sorted.begin(), sorted.end());
+
+	benchmark::title("aggregate: sum over 10K random key ranges in 1M map");
+	benchmark::report("bon::map lower_bound + scan", benchmark::measure([&] {
+		long long sum = 0;
+		for (auto &range : ranges) {
+			auto last = plainMap.lower_bound(range.second);
+			for (auto iter = plainMap.lower_bound(range.first); iter != last; ++iter)
+				sum += iter->second;
+		}
+		benchmark::doNotOptimize(sum);
+	}));
+	benchmark::report("bon::map aggregate(lower, upper)", benchmark::measure([&] {
+		long long sum = 0;
+		for (auto &range : ranges)
+			sum += summedMap.aggregate(range.first, range.second);
+		benchmark::doNotOptimize(sum);
+	}));
+}
\ No newline at end of file
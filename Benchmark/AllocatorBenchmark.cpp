@@ -0,0 +1,42 @@
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/set.hpp"
+
+namespace {
+	template <class set>
+	void churn(const std::vector<int> &keys) {
+		set target;
+
+		for (int key : keys)
+			target.insert(key);
+
+		// /  ϸ 带 
+		for (int round = 0; round < 4; round++) {
+			for (size_t i = round % 2; i < keys.size(); i += 2)
+				target.erase(keys[i]);
+			for (size_t i = round % 2; i < keys.size(); i += 2)
+				target.insert(keys[i]);
+		}
+
+		benchmark::doNotOptimize(target.size());
+	}
+}
+
+void benchmarkAllocator() {
+	const int COUNT = 200000;
+
+	std::vector<int> keys(COUNT);
+	std::mt19937 rng(0);
+	for (int i = 0; i < COUNT; i++)
+		keys[i] = static_cast<int>(rng());
+
+	using newDeleteSet = bon::set<int, std::less<int>, std::allocator<int>>;
+	using pooledSet = bon::set<int, std::less<int>, bon::pool_allocator<int>>;
+
+	benchmark::title("allocator: insert/erase churn, 200K int");
+	benchmark::report("bon::set (new/delete)", benchmark::measure([&] { churn<newDeleteSet>(keys); }));
+	benchmark::report("bon::set (pool_allocator)", benchmark::measure([&] { churn<pooledSet>(keys); }));
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/map.hpp"
+#include "../DataStructure/btree_map.hpp"
+
+namespace {
+	const int LOOKUP_COUNT = 1000000;
+
+	template <class map>
+	void measureMap(const std::string &name, const std::vector<std::pair<int, int>> &shuffled, const std::vector<int> &lookups) {
+		map target;
+
+		double insertTime = benchmark::measure([&] {
+			for (auto &element : shuffled)
+				target.insert(element);
+		}, 1);
+
+		long long found = 0;
+		double lookupTime = benchmark::measure([&] {
+			for (int key : lookups)
+				found += (target.find(key) != target.end());
+		}, 1);
+		benchmark::doNotOptimize(found);
+
+		double scanTime = benchmark::measure([&] {
+			long long sum = 0;
+			for (auto iter = target.begin(); iter != target.end(); ++iter)
+				sum += iter->second;
+			benchmark::doNotOptimize(sum);
+		}, 1);
+
+		benchmark::report(name + " insert", insertTime);
+		benchmark::report(name + " lookup", lookupTime * 1000000.0 / lookups.size(), "ns/op");
+		benchmark::report(name + " scan", scanTime);
+	}
+}
+
+void benchmarkBTree() {
+	const int MAX_COUNT = 100000000;
+
+	std::mt19937 random(42);
+	for (int count = 1000; count <= MAX_COUNT; count *= 10) {
+		// ¦ Ű ־ ȸ  ϵ 
+		std::vector<std::pair<int, int>> shuffled(count);
+		for (int i = 0; i < count; i++)
+			shuffled[i] = std::make_pair(i * 2, i);
+		std::shuffle(shuffled.begin(), shuffled.end(), random);
+
+		std::vector<int> lookups(LOOKUP_COUNT);
+		for (auto &key : lookups)
+			key = static_cast<int>(random() % (2u * count));
+
+		benchmark::title("btree: " + std::to_string(count) + " random int pairs, 1M lookups");
+		measureMap<bon::btree_map<int, int>>("bon::btree_map", shuffled, lookups);
+		measureMap<bon::map<int, int>>("bon::map", shuffled, lookups);
+		measureMap<std::map<int, int>>("std::map", shuffled, lookups);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/map.hpp"
+
+namespace {
+	const int BASE_COUNT = 1000000;
+	const int OPERATION_COUNT = 2000000;
+
+	enum operation_type { INSERT, ERASE, FIND };
+	struct operation {
+		operation_type type;
+		int key;
+	};
+
+	template <class Balance>
+	using balancedMap = bon::map<int, int, std::less<int>, bon::pool_allocator<std::pair<int, int>>, bon::no_augment, Balance>;
+
+	template <class map>
+	void measureMix(const char *name, const std::vector<int> &base, const std::vector<operation> &operations) {
+		map target;
+		for (int key : base)
+			target.insert(std::make_pair(key, key));
+
+		long long found = 0;
+		benchmark::report(name, benchmark::measure([&] {
+			for (const operation &op : operations) {
+				if (op.type == INSERT)
+					target.insert(std::make_pair(op.key, op.key));
+				else if (op.type == ERASE)
+					target.erase(op.key);
+				else
+					found += (target.find(op.key) != target.end());
+			}
+		}, 1));
+		benchmark::doNotOptimize(found);
+	}
+}
+
+//  å : 1M ʿ 2M 
+void benchmarkBalance() {
+	std::mt19937 random(42);
+	const int KEY_RANGE = BASE_COUNT * 2;
+
+	std::vector<int> base(BASE_COUNT);
+	for (auto &key : base)
+		key = static_cast<int>(random() % KEY_RANGE);
+
+	struct mix {
+		const char *title;
+		int insertPercent, erasePercent;
+	};
+	for (const mix &current : { mix{ "insert-heavy (70% insert, 10% erase, 20% find)", 70, 10 },
+								mix{ "erase-heavy (20% insert, 60% erase, 20% find)", 20, 60 },
+								mix{ "lookup-heavy (5% insert, 5% erase, 90% find)", 5, 5 } }) {
+		std::vector<operation> operations(OPERATION_COUNT);
+		for (auto &op : operations) {
+			int pick = static_cast<int>(random() % 100);
+			op.type = (pick < current.insertPercent) ? INSERT : (pick < current.insertPercent + current.erasePercent) ? ERASE : FIND;
+			op.key = static_cast<int>(random() % KEY_RANGE);
+		}
+
+		benchmark::title(std::string("balance: ") + current.title + ", 2M ops on a 1M map");
+		measureMix<balancedMap<bon::avl_balance>>("bon::map (avl_balance)", base, operations);
+		measureMix<balancedMap<bon::wavl_balance>>("bon::map (wavl_balance)", base, operations);
+		measureMix<balancedMap<bon::rb_balance>>("bon::map (rb_balance)", base, operations);
+		measureMix<std::map<int, int>>("std::map", base, operations);
+	}
+}
\ No newline at end of file
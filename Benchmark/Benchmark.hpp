@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+namespace benchmark {
+	//    ð(ms)  
+	template <class Func>
+	double measure(Func func, int repeat = 3) {
+		double best = 0;
+
+		for (int i = 0; i < repeat; i++) {
+			auto start = std::chrono::steady_clock::now();
+			func();
+			auto finish = std::chrono::steady_clock::now();
+
+			double elapsed = std::chrono::duration<double, std::milli>(finish - start).count();
+			if (i == 0 || elapsed < best)
+				best = elapsed;
+		}
+
+		return best;
+	}
+
+	inline void title(const std::string &name) {
+		std::cout << std::endl << "[" << name << "]" << std::endl;
+	}
+	inline void report(const std::string &name, double value, const std::string &unit) {
+		std::cout << "  " << std::left << std::setw(40) << name
+			<< std::right << std::setw(10) << std::fixed << std::setprecision(2) << value << " " << unit << std::endl;
+	}
+	inline void report(const std::string &name, double elapsed) {
+		report(name, elapsed, "ms");
+	}
+
+	//   ʴ  ȭ ŵ ʵ 
+	template <typename T>
+	void doNotOptimize(const T &value) {
+		static volatile char sink;
+		sink = *reinterpret_cast<const volatile char *>(&value);
+	}
+}
+
+void benchmarkAllocator();
+void benchmarkBuild();
+void benchmarkClear();
+void benchmarkScan();
+void benchmarkQueue();
+void benchmarkConcurrentQueue();
+void benchmarkSearch();
+void benchmarkBTree();
+void benchmarkAggregate();
+void benchmarkSetOperation();
+void benchmarkParallel();
+void benchmarkSnapshot();
+void benchmarkConcurrentMap();
+void benchmarkHint();
+void benchmarkLookup();
+void benchmarkFlat();
+void benchmarkFrozen();
+void benchmarkErase();
+void benchmarkBalance();
+void benchmarkCompact();
+void benchmarkCounted();
+void benchmarkUpsert();
\ No newline at end of file
@@ -0,0 +1,34 @@
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/map.hpp"
+
+void benchmarkBuild() {
+	const int COUNT = 1000000;
+
+	std::vector<std::pair<int, int>> sorted(COUNT);
+	for (int i = 0; i < COUNT; i++)
+		sorted[i] = std::make_pair(i, i);
+
+	benchmark::title("build: map from 1M sorted pairs");
+	benchmark::report("bon::map insert loop", benchmark::measure([&] {
+		bon::map<int, int> target;
+		for (auto &element : sorted)
+			target.insert(element);
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+	benchmark::report("bon::map(first, last)", benchmark::measure([&] {
+		bon::map<int, int> target(sorted.begin(), sorted.end());
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+	benchmark::report("bon::map(sorted_unique, first, last)", benchmark::measure([&] {
+		bon::map<int, int> target(bon::sorted_unique, sorted.begin(), sorted.end());
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+	benchmark::report("std::map(first, last)", benchmark::measure([&] {
+		std::map<int, int> target(sorted.begin(), sorted.end());
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/map.hpp"
+
+namespace {
+	template <class map, class V>
+	double measureClear(const std::vector<std::pair<int, V>> &sorted) {
+		map target(bon::sorted_unique, sorted.begin(), sorted.end());
+
+		return benchmark::measure([&] { target.clear(); }, 1);
+	}
+}
+
+void benchmarkClear() {
+	const int COUNT = 1000000;
+
+	std::vector<std::pair<int, int>> sortedInt(COUNT);
+	std::vector<std::pair<int, std::string>> sortedString(COUNT);
+	for (int i = 0; i < COUNT; i++) {
+		sortedInt[i] = std::make_pair(i, i);
+		sortedString[i] = std::make_pair(i, std::string(32, 'a'));
+	}
+
+	using intAllocator = std::allocator<std::pair<int, int>>;
+	using stringAllocator = std::allocator<std::pair<int, std::string>>;
+
+	benchmark::title("clear: 1M entry map");
+	benchmark::report("map<int, int> (new/delete)", measureClear<bon::map<int, int, std::less<int>, intAllocator>>(sortedInt));
+	benchmark::report("map<int, int> (pool_allocator)", measureClear<bon::map<int, int>>(sortedInt));
+	benchmark::report("map<int, string> (new/delete)", measureClear<bon::map<int, std::string, std::less<int>, stringAllocator>>(sortedString));
+	benchmark::report("map<int, string> (pool_allocator)", measureClear<bon::map<int, std::string>>(sortedString));
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/set.hpp"
+
+namespace {
+	const int ELEMENT_COUNT = 2000000;
+	const int LOOKUP_COUNT = 2000000;
+
+	size_t allocatedBytes = 0;
+
+	//   Ʈ Ҵ Ʈ   (Ҵ ϳ  ϳ)
+	template <typename T>
+	class counting_allocator : public std::allocator<T> {
+	public:
+		template <typename U>
+		struct rebind {
+			using other = counting_allocator<U>;
+		};
+
+		counting_allocator() = default;
+		template <typename U>
+		counting_allocator(const counting_allocator<U> &) {
+		}
+
+		T *allocate(size_t count) {
+			allocatedBytes += count * sizeof(T);
+			return std::allocator<T>::allocate(count);
+		}
+		void deallocate(T *ptr, size_t count) {
+			allocatedBytes -= count * sizeof(T);
+			std::allocator<T>::deallocate(ptr, count);
+		}
+	};
+
+	using compactSet = bon::set<uint32_t, std::less<uint32_t>, bon::compact_storage>;
+
+	template <class set>
+	void measure(const char *name, const std::vector<uint32_t> &keys, const std::vector<uint32_t> &lookups) {
+		set target;
+		double insertTime = benchmark::measure([&] {
+			target.clear();
+			for (uint32_t key : keys)
+				target.insert(key);
+		});
+
+		long long found = 0;
+		double findTime = benchmark::measure([&] {
+			for (uint32_t key : lookups)
+				found += (target.find(key) != target.end());
+		});
+		benchmark::doNotOptimize(found);
+
+		long long sum = 0;
+		double scanTime = benchmark::measure([&] {
+			for (uint32_t value : target)
+				sum += value;
+		});
+		benchmark::doNotOptimize(sum);
+
+		benchmark::report(std::string(name) + " random insert", insertTime);
+		benchmark::report(std::string(name) + " random find", findTime);
+		benchmark::report(std::string(name) + " in-order scan", scanTime);
+	}
+}
+
+//  ҿ  (64Ʈ  )  32Ʈ ε      ӵ
+void benchmarkCompact() {
+	std::mt19937 random(42);
+
+	std::vector<uint32_t> keys(ELEMENT_COUNT);
+	for (auto &key : keys)
+		key = static_cast<uint32_t>(random());
+
+	std::vector<uint32_t> lookups(LOOKUP_COUNT);
+	for (auto &key : lookups)
+		key = keys[random() % ELEMENT_COUNT];
+
+	benchmark::title("compact: 2M random uint32_t keys, 2M successful finds");
+	measure<bon::set<uint32_t>>("bon::set", keys, lookups);
+	measure<compactSet>("bon::set (compact_storage)", keys, lookups);
+
+	benchmark::title("compact: memory per element (node storage only)");
+	{
+		bon::set<uint32_t, std::less<uint32_t>, counting_allocator<uint32_t>> target(keys.begin(), keys.end());
+		benchmark::report("bon::set", static_cast<double>(allocatedBytes) / target.size(), "bytes");
+	}
+	{
+		compactSet target(keys.begin(), keys.end());
+		benchmark::report("bon::set (compact_storage) random insert", static_cast<double>(target.memory_usage()) / target.size(), "bytes");
+	}
+
+	std::sort(keys.begin(), keys.end());
+	keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+	{
+		compactSet target(bon::sorted_unique, keys.begin(), keys.end());
+		benchmark::report("bon::set (compact_storage) sorted build", static_cast<double>(target.memory_usage()) / target.size(), "bytes");
+	}
+}
\ No newline at end of file
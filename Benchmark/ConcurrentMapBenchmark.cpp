@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/concurrent_map.hpp"
+#include "../DataStructure/map.hpp"
+
+namespace {
+	const int COUNT = 100000;
+	const int DURATION_MS = 300;
+
+	//  : shared_timed_mutex  bon::map
+	class lockedMap {
+	public:
+		lockedMap() {
+			for (int i = 0; i < COUNT; i++)
+				container.insert(std::make_pair(i * 2, i));
+		}
+
+		void insert_or_assign(int key, int value) {
+			std::unique_lock<std::shared_timed_mutex> lock(mutex);
+			auto iter = container.find(key);
+			if (iter != container.end())
+				iter->second = value;
+			else
+				container.insert(std::make_pair(key, value));
+		}
+		bool find(int key, int &value) {
+			std::shared_lock<std::shared_timed_mutex> lock(mutex);
+			auto iter = container.find(key);
+			if (iter == container.end())
+				return false;
+
+			value = iter->second;
+			return true;
+		}
+
+	private:
+		std::shared_timed_mutex mutex;
+		bon::map<int, int> container;
+	};
+
+	class publishedMap {
+	public:
+		publishedMap() {
+			container.update([](bon::persistent_map<int, int> &target) {
+				for (int i = 0; i < COUNT; i++)
+					target.insert(std::make_pair(i * 2, i));
+			});
+		}
+
+		void insert_or_assign(int key, int value) {
+			container.insert_or_assign(key, value);
+		}
+		bool find(int key, int &value) {
+			return container.find(key, value);
+		}
+
+	private:
+		bon::concurrent_map<int, int> container;
+	};
+
+	// writer ϳ    readerCount 尡  Ƚ (ʴ 鸸 ȸ), writes  Ƚ (ʴ õ ȸ)
+	template <class map>
+	double run(int readerCount, double &writes) {
+		map target;
+		std::atomic<bool> bStop(false);
+		std::atomic<long long> reads(0);
+		std::vector<std::thread> threads;
+
+		for (int r = 0; r < readerCount; r++) {
+			threads.emplace_back([&, r] {
+				std::mt19937 random(r);
+				long long count = 0, found = 0;
+				int value;
+				while (!bStop.load(std::memory_order_relaxed)) {
+					for (int i = 0; i < 64; i++)
+						found += target.find(static_cast<int>(random() % (COUNT * 2)), value) ? 1 : 0;
+					count += 64;
+				}
+				reads += count;
+				benchmark::doNotOptimize(found);
+			});
+		}
+		std::thread writer([&] {
+			std::mt19937 random(12345);
+			long long count = 0;
+			while (!bStop.load(std::memory_order_relaxed)) {
+				target.insert_or_assign(static_cast<int>(random() % (COUNT * 2)), static_cast<int>(count));
+				count++;
+			}
+			writes = count / static_cast<double>(DURATION_MS);
+		});
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(DURATION_MS));
+		bStop = true;
+		for (auto &thread : threads)
+			thread.join();
+		writer.join();
+
+		return reads.load() / (DURATION_MS * 1000.0);
+	}
+}
+
+void benchmarkConcurrentMap() {
+	int maxThreads = std::max(4, static_cast<int>(std::thread::hardware_concurrency()));
+
+	benchmark::title("concurrent map: 100K keys, random find while one writer keeps writing");
+	for (int readerCount = 1; readerCount <= maxThreads; readerCount *= 2) {
+		double lockedWrites = 0, publishedWrites = 0;
+		double locked = run<lockedMap>(readerCount, lockedWrites);
+		double published = run<publishedMap>(readerCount, publishedWrites);
+
+		std::string suffix = " (" + std::to_string(readerCount) + " readers)";
+		benchmark::report("shared_timed_mutex + bon::map" + suffix, locked, "M reads/s");
+		benchmark::report("  writer", lockedWrites, "K writes/s");
+		benchmark::report("bon::concurrent_map" + suffix, published, "M reads/s");
+		benchmark::report("  writer", publishedWrites, "K writes/s");
+	}
+}
\ No newline at end of file
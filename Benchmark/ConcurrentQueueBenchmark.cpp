@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/concurrent_queue.hpp"
+#include "../DataStructure/queue.hpp"
+
+namespace {
+	const int ITEM_COUNT = 2000000;
+
+	//  : ܺ mutex  bon::queue
+	class lockedQueue {
+	public:
+		explicit lockedQueue(size_t) {
+		}
+
+		bool try_push(long long value) {
+			std::lock_guard<std::mutex> lock(mutex);
+			container.push(value);
+			return true;
+		}
+		bool try_pop(long long &value) {
+			std::lock_guard<std::mutex> lock(mutex);
+			if (container.empty())
+				return false;
+			value = container.front();
+			container.pop();
+			return true;
+		}
+
+	private:
+		std::mutex mutex;
+		bon::queue<long long> container;
+	};
+
+	long long now() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// /Һ pairCount  ITEM_COUNT , ҿ ð(ms)  ð ǥ ȯ
+	template <class queue>
+	double run(int pairCount, std::vector<long long> &latencies) {
+		queue target(1024);
+		std::atomic<int> consumed(0);
+		std::vector<std::vector<long long>> samples(pairCount);
+		std::vector<std::thread> threads;
+
+		int perProducer = ITEM_COUNT / pairCount;
+		int total = perProducer * pairCount;
+
+		auto start = std::chrono::steady_clock::now();
+		for (int p = 0; p < pairCount; p++) {
+			threads.emplace_back([&] {
+				for (int i = 0; i < perProducer; i++) {
+					while (!target.try_push(now()))
+						std::this_thread::yield();
+				}
+			});
+		}
+		for (int c = 0; c < pairCount; c++) {
+			threads.emplace_back([&, c] {
+				long long stamp;
+				int count = 0;
+				while (consumed.load(std::memory_order_relaxed) < total) {
+					if (!target.try_pop(stamp)) {
+						std::this_thread::yield();
+						continue;
+					}
+					if ((count++ & 63) == 0)
+						samples[c].push_back(now() - stamp);
+					consumed.fetch_add(1, std::memory_order_relaxed);
+				}
+			});
+		}
+		for (auto &thread : threads)
+			thread.join();
+		auto finish = std::chrono::steady_clock::now();
+
+		latencies.clear();
+		for (auto &sample : samples)
+			latencies.insert(latencies.end(), sample.begin(), sample.end());
+		std::sort(latencies.begin(), latencies.end());
+
+		return std::chrono::duration<double, std::milli>(finish - start).count();
+	}
+
+	template <class queue>
+	void measure(const std::string &name, int pairCount) {
+		std::vector<long long> latencies;
+		double elapsed = run<queue>(pairCount, latencies);
+
+		std::string label = name + " " + std::to_string(pairCount) + "P/" + std::to_string(pairCount) + "C";
+		benchmark::report(label + " throughput", ITEM_COUNT / elapsed / 1000.0, "Mops/s");
+		if (!latencies.empty()) {
+			benchmark::report(label + " latency p50", latencies[latencies.size() / 2] / 1000.0, "us");
+			benchmark::report(label + " latency p99", latencies[latencies.size() * 99 / 100] / 1000.0, "us");
+		}
+	}
+}
+
+void benchmarkConcurrentQueue() {
+	int maxPairCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) / 2);
+
+	benchmark::title("concurrent_queue: 2M items, capacity 1024");
+	for (int pairCount = 1; pairCount <= maxPairCount; pairCount *= 2) {
+		measure<lockedQueue>("mutex + bon::queue", pairCount);
+		measure<bon::concurrent_queue<long long>>("bon::concurrent_queue", pairCount);
+	}
+}
\ No newline at end of file
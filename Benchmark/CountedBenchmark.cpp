@@ -0,0 +1,76 @@
+#include <random>
+#include <set>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/AVLTree.hpp"
+#include "../DataStructure/counted_multiset.hpp"
+
+namespace {
+	const int EVENT_COUNT = 4000000;
+	const int KEY_COUNT = 5000;
+
+	using multiTree = bon::AVLTree<int>;
+
+	// ߺ  Ʈ      ȸؾ   
+	int countOf(const multiTree &target, int key) {
+		int result = 0;
+		for (auto iter = target.lower_bound(key), last = target.upper_bound(key); iter != last; ++iter)
+			result++;
+		return result;
+	}
+	int countOf(const bon::counted_multiset<int> &target, int key) {
+		return target.count(key);
+	}
+	int countOf(const std::multiset<int> &target, int key) {
+		return static_cast<int>(target.count(key));
+	}
+
+	template <class set>
+	void measure(const char *name, set &target, const std::vector<int> &events) {
+		double insertTime = benchmark::measure([&] {
+			for (int key : events)
+				target.insert(key);
+		}, 1);
+
+		long long total = 0;
+		double countTime = benchmark::measure([&] {
+			for (int key = 0; key < KEY_COUNT; key++)
+				total += countOf(target, key);
+		}, 1);
+		benchmark::doNotOptimize(total);
+
+		double eraseTime = benchmark::measure([&] {
+			for (int key = 0; key < KEY_COUNT; key++)
+				target.erase(key);
+		}, 1);
+		benchmark::doNotOptimize(target.size());
+
+		benchmark::report(std::string(name) + " insert", insertTime);
+		benchmark::report(std::string(name) + " count every key", countTime);
+		benchmark::report(std::string(name) + " erase every key", eraseTime);
+	}
+}
+
+//     ݺǴ ̺Ʈ 
+void benchmarkCounted() {
+	std::mt19937 random(42);
+
+	std::vector<int> events(EVENT_COUNT);
+	for (auto &key : events)
+		key = static_cast<int>(random() % KEY_COUNT);
+
+	benchmark::title("counted: 4M events over 5000 distinct keys");
+	{
+		multiTree target(true);
+		measure("bon::AVLTree (multi)", target, events);
+	}
+	{
+		bon::counted_multiset<int> target;
+		measure("bon::counted_multiset", target, events);
+	}
+	{
+		std::multiset<int> target;
+		measure("std::multiset", target, events);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/map.hpp"
+
+namespace {
+	const int BASE_COUNT = 1000000;
+	const int OPERATION_COUNT = 2000000;
+
+	enum operation_type { INSERT, ERASE, FIND };
+	struct operation {
+		operation_type type;
+		int key;
+	};
+
+	template <class map>
+	void measureChurn(const char *name, const std::vector<int> &base, const std::vector<operation> &operations) {
+		benchmark::report(name, benchmark::measure([&] {
+			map target;
+			for (int key : base)
+				target.insert(std::make_pair(key, key));
+
+			long long found = 0;
+			for (const operation &op : operations) {
+				if (op.type == INSERT)
+					target.insert(std::make_pair(op.key, op.key));
+				else if (op.type == ERASE)
+					target.erase(op.key);
+				else
+					found += (target.find(op.key) != target.end());
+			}
+			benchmark::doNotOptimize(found);
+			benchmark::doNotOptimize(target.size());
+		}, 1));
+	}
+	template <class map>
+	void measureEraseAll(const char *name, const std::vector<int> &base) {
+		map target;
+		for (int key : base)
+			target.insert(std::make_pair(key, key));
+
+		benchmark::report(name, benchmark::measure([&] {
+			for (int key : base)
+				target.erase(key);
+			benchmark::doNotOptimize(target.size());
+		}, 1));
+	}
+}
+
+//   ۾:  40%,  40%, ȸ 20%
+void benchmarkErase() {
+	std::mt19937 random(42);
+	const int KEY_RANGE = BASE_COUNT * 2;
+
+	std::vector<int> base(BASE_COUNT);
+	for (auto &key : base)
+		key = static_cast<int>(random() % KEY_RANGE);
+
+	std::vector<operation> operations(OPERATION_COUNT);
+	for (auto &op : operations) {
+		unsigned pick = random() % 10;
+		op.type = (pick < 4) ? INSERT : (pick < 8) ? ERASE : FIND;
+		op.key = static_cast<int>(random() % KEY_RANGE);
+	}
+
+	benchmark::title("erase: 2M mixed operations (40% insert, 40% erase, 20% find) on a 1M map");
+	measureChurn<bon::map<int, int>>("bon::map", base, operations);
+	measureChurn<std::map<int, int>>("std::map", base, operations);
+
+	std::vector<int> shuffled(base);
+	std::shuffle(shuffled.begin(), shuffled.end(), random);
+
+	benchmark::title("erase: erase all 1M keys in random order");
+	measureEraseAll<bon::map<int, int>>("bon::map", shuffled);
+	measureEraseAll<std::map<int, int>>("std::map", shuffled);
+}
\ No newline at end of file
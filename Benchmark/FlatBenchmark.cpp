@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/flat_map.hpp"
+#include "../DataStructure/map.hpp"
+
+namespace {
+	const int LOOKUP_COUNT = 1000000;
+
+	template <class map>
+	void measureLookup(const std::string &name, const map &target, const std::vector<int> &lookups) {
+		long long found = 0;
+		double lookupTime = benchmark::measure([&] {
+			for (int key : lookups)
+				found += (target.find(key) != target.end());
+		});
+		benchmark::doNotOptimize(found);
+
+		double scanTime = benchmark::measure([&] {
+			long long sum = 0;
+			for (auto iter = target.begin(); iter != target.end(); ++iter)
+				sum += iter->second;
+			benchmark::doNotOptimize(sum);
+		});
+
+		benchmark::report(name + " lookup", lookupTime * 1000000.0 / lookups.size(), "ns/op");
+		benchmark::report(name + " scan", scanTime);
+	}
+}
+
+//     ȸϴ 
+void benchmarkFlat() {
+	std::mt19937 random(42);
+
+	for (int count : { 1000, 100000, 10000000 }) {
+		// ¦ Ű ־ ȸ  ϵ 
+		std::vector<std::pair<int, int>> shuffled(count);
+		for (int i = 0; i < count; i++)
+			shuffled[i] = std::make_pair(i * 2, i);
+		std::shuffle(shuffled.begin(), shuffled.end(), random);
+
+		std::vector<int> lookups(LOOKUP_COUNT);
+		for (auto &key : lookups)
+			key = static_cast<int>(random() % (2u * count));
+
+		benchmark::title("flat: " + std::to_string(count) + " random int pairs, 1M lookups");
+		{
+			bon::map<int, int> target;
+			benchmark::report("bon::map build", benchmark::measure([&] {
+				target = bon::map<int, int>(shuffled.begin(), shuffled.end());
+			}, 1));
+			measureLookup("bon::map", target, lookups);
+
+			benchmark::report("bon::flat_map(const map &)", benchmark::measure([&] {
+				bon::flat_map<int, int> converted(target);
+				benchmark::doNotOptimize(converted.size());
+			}, 1));
+		}
+		{
+			bon::flat_map<int, int> target;
+			benchmark::report("bon::flat_map build", benchmark::measure([&] {
+				target = bon::flat_map<int, int>(shuffled.begin(), shuffled.end());
+			}, 1));
+			measureLookup("bon::flat_map", target, lookups);
+		}
+	}
+
+	// 10  1  ߰: Ҹ  Ź  ű
+	const int BASE_COUNT = 100000;
+	const int BATCH_COUNT = 10000;
+	std::vector<std::pair<int, int>> base(BASE_COUNT), batch(BATCH_COUNT);
+	for (auto &element : base)
+		element = std::make_pair(static_cast<int>(random() >> 1), 0);
+	for (auto &element : batch)
+		element = std::make_pair(static_cast<int>(random() >> 1), 1);
+
+	benchmark::title("flat: add 10K random pairs to 100K");
+	benchmark::report("bon::flat_map insert loop", benchmark::measure([&] {
+		bon::flat_map<int, int> target(base.begin(), base.end());
+		for (auto &element : batch)
+			target.insert(element);
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+	benchmark::report("bon::flat_map insert(first, last)", benchmark::measure([&] {
+		bon::flat_map<int, int> target(base.begin(), base.end());
+		target.insert(batch.begin(), batch.end());
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/frozen_set.hpp"
+#include "../DataStructure/set.hpp"
+
+namespace {
+	const int LOOKUP_COUNT = 1000000;
+
+	template <class Func>
+	void measureLowerBound(const std::string &name, const std::vector<int> &lookups, Func &&lowerBound) {
+		long long sum = 0;
+		double lookupTime = benchmark::measure([&] {
+			for (int key : lookups)
+				sum += lowerBound(key);
+		});
+		benchmark::doNotOptimize(sum);
+
+		benchmark::report(name, lookupTime * 1000000.0 / lookups.size(), "ns/op");
+	}
+}
+
+// ĵ   lower_bound: L1  ũ LLC Ѵ ũ
+void benchmarkFrozen() {
+	std::mt19937 random(42);
+
+	for (int count : { 1 << 10, 1 << 15, 1 << 20, 1 << 22, 1 << 24 }) {
+		std::vector<int> sorted(count);
+		for (int i = 0; i < count; i++)
+			sorted[i] = i * 2;
+
+		std::vector<int> lookups(LOOKUP_COUNT);
+		for (auto &key : lookups)
+			key = static_cast<int>(random() % (2u * count));
+
+		benchmark::title("frozen: lower_bound on " + std::to_string(count) + " ints (" + std::to_string(count * sizeof(int) / 1024) + " KB), 1M random lookups");
+		measureLowerBound("std::lower_bound (sorted vector)", lookups, [&](int key) {
+			auto iter = std::lower_bound(sorted.begin(), sorted.end(), key);
+			return iter == sorted.end() ? -1 : *iter;
+		});
+		{
+			bon::frozen_set<int> target(bon::sorted_unique, sorted.begin(), sorted.end());
+			measureLowerBound("bon::frozen_set", lookups, [&](int key) {
+				auto iter = target.lower_bound(key);
+				return iter == target.end() ? -1 : *iter;
+			});
+		}
+		//   Ʈ ū ũ⿡ ޸𸮰   ־ 
+		if (count <= (1 << 22)) {
+			bon::set<int> target(bon::sorted_unique, sorted.begin(), sorted.end());
+			measureLowerBound("bon::set", lookups, [&](int key) {
+				auto iter = target.lower_bound(key);
+				return iter == target.end() ? -1 : *iter;
+			});
+		}
+	}
+}
\ No newline at end of file
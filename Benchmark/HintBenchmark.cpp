@@ -0,0 +1,65 @@
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/map.hpp"
+
+// ð迭 ε:   ڿ ϴ Ÿӽ ϳ 
+void benchmarkHint() {
+	const int BASE_COUNT = 1000000;
+	const int APPEND_COUNT = 1000000;
+
+	std::vector<std::pair<long long, int>> base(BASE_COUNT), appended(APPEND_COUNT);
+	for (int i = 0; i < BASE_COUNT; i++)
+		base[i] = std::make_pair(static_cast<long long>(i) * 10, i);
+	for (int i = 0; i < APPEND_COUNT; i++)
+		appended[i] = std::make_pair(static_cast<long long>(BASE_COUNT + i) * 10, i);
+
+	//   ʰ ϴ Ÿӽ  
+	std::mt19937 random(42);
+	std::vector<std::pair<long long, int>> jittered(appended);
+	for (int i = 1; i < APPEND_COUNT; i++) {
+		if (random() % 16 == 0)
+			std::swap(jittered[i - 1], jittered[i]);
+	}
+
+	benchmark::title("hint: append 1M increasing keys to a 1M map");
+	benchmark::report("bon::map insert", benchmark::measure([&] {
+		bon::map<long long, int> target(base.begin(), base.end());
+		for (auto &element : appended)
+			target.insert(element);
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+	benchmark::report("bon::map insert(end(), value)", benchmark::measure([&] {
+		bon::map<long long, int> target(base.begin(), base.end());
+		for (auto &element : appended)
+			target.insert(target.end(), element);
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+	benchmark::report("bon::map insert(first, last)", benchmark::measure([&] {
+		bon::map<long long, int> target(base.begin(), base.end());
+		target.insert(appended.begin(), appended.end());
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+	benchmark::report("std::map insert(end(), value)", benchmark::measure([&] {
+		std::map<long long, int> target(base.begin(), base.end());
+		for (auto &element : appended)
+			target.insert(target.end(), element);
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+
+	benchmark::title("hint: append 1M nearly increasing keys (1/16 swapped) to a 1M map");
+	benchmark::report("bon::map insert", benchmark::measure([&] {
+		bon::map<long long, int> target(base.begin(), base.end());
+		for (auto &element : jittered)
+			target.insert(element);
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+	benchmark::report("bon::map insert(first, last)", benchmark::measure([&] {
+		bon::map<long long, int> target(base.begin(), base.end());
+		target.insert(jittered.begin(), jittered.end());
+		benchmark::doNotOptimize(target.size());
+	}, 1));
+}
\ No newline at end of file
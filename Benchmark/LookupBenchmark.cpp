@@ -0,0 +1,49 @@
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/set.hpp"
+
+namespace {
+	const int LOOKUP_COUNT = 10000000;
+
+	// ȣϴ   ˰ Ƿ  Ÿ  ȣ Ǯ  
+	template <class set>
+	long long countFound(const set &target, const std::vector<int> &keys) {
+		long long found = 0;
+		for (int i = 0; i < LOOKUP_COUNT; i++) {
+			if (target.find(keys[i & (static_cast<int>(keys.size()) - 1)]) != target.end())
+				found++;
+		}
+		return found;
+	}
+}
+
+//  Ʈ ݺ ȸ (ȣ  Ž 뿡  ŭ)
+void benchmarkLookup() {
+	std::mt19937 random(42);
+
+	for (int count : { 8, 64, 512 }) {
+		std::vector<int> values(count);
+		for (int i = 0; i < count; i++)
+			values[i] = i * 2;
+
+		std::vector<int> keys(1 << 16);
+		for (auto &key : keys)
+			key = static_cast<int>(random() % (count * 2));
+
+		bon::set<int> bonSet(values.begin(), values.end());
+		std::set<int> stdSet(values.begin(), values.end());
+
+		benchmark::title("lookup: 10M find in a " + std::to_string(count) + "-element set");
+		benchmark::report("bon::set find", benchmark::measure([&] {
+			benchmark::doNotOptimize(countFound(bonSet, keys));
+		}) * 1000000.0 / LOOKUP_COUNT, "ns/op");
+		benchmark::report("std::set find", benchmark::measure([&] {
+			benchmark::doNotOptimize(countFound(stdSet, keys));
+		}) * 1000000.0 / LOOKUP_COUNT, "ns/op");
+	}
+	benchmark::report("sizeof(bon::set<int>)", sizeof(bon::set<int>), "bytes");
+}
\ No newline at end of file
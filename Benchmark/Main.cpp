@@ -0,0 +1,28 @@
+#include "Benchmark.hpp"
+
+int main() {
+	benchmarkAllocator();
+	benchmarkBuild();
+	benchmarkClear();
+	benchmarkScan();
+	benchmarkQueue();
+	benchmarkConcurrentQueue();
+	benchmarkSearch();
+	benchmarkBTree();
+	benchmarkAggregate();
+	benchmarkSetOperation();
+	benchmarkParallel();
+	benchmarkSnapshot();
+	benchmarkConcurrentMap();
+	benchmarkHint();
+	benchmarkLookup();
+	benchmarkFlat();
+	benchmarkFrozen();
+	benchmarkErase();
+	benchmarkBalance();
+	benchmarkCompact();
+	benchmarkCounted();
+	benchmarkUpsert();
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/set.hpp"
+
+namespace {
+	template <class set>
+	void measureParallel(const std::string &name, const std::vector<int> &sortedValues, const std::vector<int> &randomValues, const std::vector<int> &otherValues) {
+		benchmark::report(name + " build sorted", benchmark::measure([&] {
+			set target(sortedValues.begin(), sortedValues.end());
+			benchmark::doNotOptimize(target.size());
+		}, 1));
+		benchmark::report(name + " build sorted (parallel)", benchmark::measure([&] {
+			set target(bon::parallel, sortedValues.begin(), sortedValues.end());
+			benchmark::doNotOptimize(target.size());
+		}, 1));
+		benchmark::report(name + " build random", benchmark::measure([&] {
+			set target(randomValues.begin(), randomValues.end());
+			benchmark::doNotOptimize(target.size());
+		}, 1));
+		benchmark::report(name + " build random (parallel)", benchmark::measure([&] {
+			set target(bon::parallel, randomValues.begin(), randomValues.end());
+			benchmark::doNotOptimize(target.size());
+		}, 1));
+
+		//  ð  (Է Ʈ ̸ )
+		{
+			set target(randomValues.begin(), randomValues.end()), other(otherValues.begin(), otherValues.end());
+			benchmark::report(name + " set_union", benchmark::measure([&] {
+				target.set_union(std::move(other));
+				benchmark::doNotOptimize(target.size());
+			}, 1));
+			benchmark::report(name + " clear", benchmark::measure([&] {
+				target.clear();
+			}, 1));
+		}
+		{
+			set target(randomValues.begin(), randomValues.end()), other(otherValues.begin(), otherValues.end());
+			benchmark::report(name + " set_union (parallel)", benchmark::measure([&] {
+				target.set_union(bon::parallel, std::move(other));
+				benchmark::doNotOptimize(target.size());
+			}, 1));
+			benchmark::report(name + " clear (parallel)", benchmark::measure([&] {
+				target.clear(bon::parallel);
+			}, 1));
+		}
+	}
+}
+
+void benchmarkParallel() {
+	const int COUNT = 2000000;
+
+	std::mt19937 random(42);
+	std::vector<int> randomValues(COUNT), otherValues(COUNT);
+	for (auto &value : randomValues)
+		value = static_cast<int>(random() >> 1);
+	for (auto &value : otherValues)
+		value = static_cast<int>(random() >> 1);
+
+	std::vector<int> sortedValues(randomValues);
+	std::sort(sortedValues.begin(), sortedValues.end());
+	sortedValues.erase(std::unique(sortedValues.begin(), sortedValues.end()), sortedValues.end());
+
+	benchmark::title("parallel: 2M elements, " + std::to_string(bon::thread_pool::shared().size()) + " worker threads");
+	measureParallel<bon::set<int>>("bon::set", sortedValues, randomValues, otherValues);
+	measureParallel<bon::set<int, std::less<int>, std::allocator<int>>>("bon::set (std::allocator)", sortedValues, randomValues, otherValues);
+}
\ No newline at end of file
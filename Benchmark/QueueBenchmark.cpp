@@ -0,0 +1,58 @@
+#include <queue>
+#include <stack>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/list.hpp"
+#include "../DataStructure/queue.hpp"
+#include "../DataStructure/stack.hpp"
+
+namespace {
+	const int COUNT = 1000000;
+	const int BATCH = 64;
+
+	// ۾ ťó ݾ װ  
+	template <class queue>
+	void runQueue() {
+		queue target;
+		long long sum = 0;
+
+		for (int i = 0; i < COUNT; i += BATCH) {
+			for (int j = 0; j < BATCH; j++)
+				target.push(i + j);
+			for (int j = 0; j < BATCH; j++) {
+				sum += target.front();
+				target.pop();
+			}
+		}
+
+		benchmark::doNotOptimize(sum);
+	}
+	template <class stack>
+	void runStack() {
+		stack target;
+		long long sum = 0;
+
+		for (int i = 0; i < COUNT; i += BATCH) {
+			for (int j = 0; j < BATCH; j++)
+				target.push(i + j);
+			for (int j = 0; j < BATCH; j++) {
+				sum += target.top();
+				target.pop();
+			}
+		}
+
+		benchmark::doNotOptimize(sum);
+	}
+}
+
+void benchmarkQueue() {
+	benchmark::title("queue: 1M push/pop of int in batches of 64");
+	benchmark::report("bon::queue (list)", benchmark::measure(runQueue<bon::queue<int, bon::list<int>>>));
+	benchmark::report("bon::queue (ring_buffer)", benchmark::measure(runQueue<bon::queue<int>>));
+	benchmark::report("std::queue", benchmark::measure(runQueue<std::queue<int>>));
+
+	benchmark::title("stack: 1M push/pop of int in batches of 64");
+	benchmark::report("bon::stack (list)", benchmark::measure(runStack<bon::stack<int, bon::list<int>>>));
+	benchmark::report("bon::stack (vector)", benchmark::measure(runStack<bon::stack<int>>));
+	benchmark::report("std::stack", benchmark::measure(runStack<std::stack<int>>));
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#include <set>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/set.hpp"
+
+namespace {
+	template <class set>
+	long long scan(const set &target) {
+		long long sum = 0;
+		for (auto iter = target.begin(); iter != target.end(); ++iter)
+			sum += *iter;
+		return sum;
+	}
+}
+
+void benchmarkScan() {
+	const int COUNT = 1000000;
+
+	std::vector<int> sorted(COUNT);
+	for (int i = 0; i < COUNT; i++)
+		sorted[i] = i;
+
+	bon::set<int> bonSet(bon::sorted_unique, sorted.begin(), sorted.end());
+	std::set<int> stdSet(sorted.begin(), sorted.end());
+
+	benchmark::title("scan: in-order traversal of 1M int");
+	benchmark::report("bon::set", benchmark::measure([&] { benchmark::doNotOptimize(scan(bonSet)); }));
+	benchmark::report("std::set", benchmark::measure([&] { benchmark::doNotOptimize(scan(stdSet)); }));
+}
\ No newline at end of file
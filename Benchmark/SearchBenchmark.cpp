@@ -0,0 +1,60 @@
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/set.hpp"
+
+namespace {
+	//  Ƚ  
+	class countingLess {
+	public:
+		bool operator()(const std::string &left, const std::string &right) const {
+			count++;
+			return left < right;
+		}
+
+		static long long count;
+	};
+	long long countingLess::count = 0;
+
+	template <class set>
+	void measureSearch(const std::string &name, const set &target, const std::vector<std::string> &keys) {
+		long long found = 0;
+		countingLess::count = 0;
+		double elapsed = benchmark::measure([&] {
+			for (auto &key : keys)
+				found += (target.find(key) != target.end());
+		}, 1);
+		benchmark::doNotOptimize(found);
+		benchmark::report(name + " find", elapsed);
+		benchmark::report(name + " find compares/op", static_cast<double>(countingLess::count) / keys.size(), "");
+
+		countingLess::count = 0;
+		for (auto &key : keys)
+			benchmark::doNotOptimize(*target.lower_bound(key));
+		benchmark::report(name + " lower_bound compares/op", static_cast<double>(countingLess::count) / keys.size(), "");
+
+		countingLess::count = 0;
+		for (auto &key : keys)
+			benchmark::doNotOptimize(target.upper_bound(key) == target.end());
+		benchmark::report(name + " upper_bound compares/op", static_cast<double>(countingLess::count) / keys.size(), "");
+	}
+}
+
+void benchmarkSearch() {
+	const int COUNT = 100000;
+
+	std::mt19937 random(42);
+	std::vector<std::string> keys(COUNT);
+	for (auto &key : keys)
+		key = "key-" + std::to_string(random());
+
+	bon::set<std::string, countingLess> bonSet(keys.begin(), keys.end());
+	std::set<std::string, countingLess> stdSet(keys.begin(), keys.end());
+
+	benchmark::title("search: 100K string keys, comparator calls per lookup");
+	measureSearch("bon::set", bonSet, keys);
+	measureSearch("std::set", stdSet, keys);
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/set.hpp"
+
+namespace {
+	// ū ε 带 ʷ ġ ð  (纻 ̸ غ)
+	template <class set>
+	void measureMerge(const std::string &name, const std::vector<int> &base, const std::vector<std::vector<int>> &shards) {
+		{
+			set merged(base.begin(), base.end());
+			std::vector<set> pending;
+			for (auto &shard : shards)
+				pending.emplace_back(shard.begin(), shard.end());
+
+			benchmark::report(name + " insert loop", benchmark::measure([&] {
+				for (auto &shard : pending)
+					merged.insert(shard.begin(), shard.end());
+				benchmark::doNotOptimize(merged.size());
+			}, 1));
+		}
+		{
+			set merged(base.begin(), base.end());
+			std::vector<set> pending;
+			for (auto &shard : shards)
+				pending.emplace_back(shard.begin(), shard.end());
+
+			benchmark::report(name + " set_union", benchmark::measure([&] {
+				for (auto &shard : pending)
+					merged.set_union(std::move(shard));
+				benchmark::doNotOptimize(merged.size());
+			}, 1));
+		}
+	}
+}
+
+void benchmarkSetOperation() {
+	const int BASE_COUNT = 1000000;
+	const int SHARD_COUNT = 10;
+	const int SHARD_SIZE = 100000;
+
+	std::mt19937 random(42);
+	std::vector<int> base(BASE_COUNT);
+	for (auto &value : base)
+		value = static_cast<int>(random() >> 1);
+
+	std::vector<std::vector<int>> shards(SHARD_COUNT, std::vector<int>(SHARD_SIZE));
+	for (auto &shard : shards) {
+		for (auto &value : shard)
+			value = static_cast<int>(random() >> 1);
+	}
+
+	// ð Űó  尡  Ű  ū 
+	std::vector<int> sortedBase(BASE_COUNT);
+	for (int i = 0; i < BASE_COUNT; i++)
+		sortedBase[i] = i;
+	std::vector<std::vector<int>> appendShards(SHARD_COUNT, std::vector<int>(SHARD_SIZE));
+	for (int i = 0; i < SHARD_COUNT; i++) {
+		for (int j = 0; j < SHARD_SIZE; j++)
+			appendShards[i][j] = BASE_COUNT + i * SHARD_SIZE + j;
+	}
+
+	benchmark::title("set operation: merge 10 x 100K random shards into 1M set");
+	measureMerge<bon::set<int>>("bon::set", base, shards);
+	measureMerge<bon::set<int, std::less<int>, std::allocator<int>>>("bon::set (std::allocator)", base, shards);
+
+	benchmark::title("set operation: merge 10 x 100K appended shards into 1M set");
+	measureMerge<bon::set<int>>("bon::set", sortedBase, appendShards);
+	measureMerge<bon::set<int, std::less<int>, std::allocator<int>>>("bon::set (std::allocator)", sortedBase, appendShards);
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/map.hpp"
+#include "../DataStructure/persistent_map.hpp"
+
+namespace {
+	const int COUNT = 1000000;
+	const int ROUND = 100;
+	const int WRITES_PER_ROUND = 100;
+}
+
+//  100 б  ϳ   ε ó
+void benchmarkSnapshot() {
+	std::mt19937 random(42);
+	std::vector<std::pair<int, int>> values(COUNT);
+	for (int i = 0; i < COUNT; i++)
+		values[i] = std::make_pair(i * 2, i);
+
+	std::vector<int> writes(ROUND * WRITES_PER_ROUND);
+	for (auto &key : writes)
+		key = static_cast<int>(random() % (COUNT * 2));
+
+	benchmark::title("snapshot: 1M entries, 100 snapshots with 100 writes between each");
+	{
+		bon::map<int, int> target(values.begin(), values.end());
+		std::vector<bon::map<int, int>> snapshots;
+		snapshots.reserve(ROUND);
+
+		benchmark::report("bon::map deep copy", benchmark::measure([&] {
+			for (int round = 0; round < ROUND; round++) {
+				for (int i = 0; i < WRITES_PER_ROUND; i++)
+					target.insert(std::make_pair(writes[round * WRITES_PER_ROUND + i], round));
+				snapshots.push_back(target);
+			}
+			benchmark::doNotOptimize(snapshots.back().size());
+		}, 1));
+	}
+	{
+		bon::persistent_map<int, int> target(values.begin(), values.end());
+		std::vector<bon::persistent_map<int, int>> snapshots;
+		snapshots.reserve(ROUND);
+
+		benchmark::report("bon::persistent_map snapshot", benchmark::measure([&] {
+			for (int round = 0; round < ROUND; round++) {
+				for (int i = 0; i < WRITES_PER_ROUND; i++)
+					target.insert_or_assign(writes[round * WRITES_PER_ROUND + i], round);
+				snapshots.push_back(target.snapshot());
+			}
+			benchmark::doNotOptimize(snapshots.back().size());
+		}, 1));
+	}
+
+	//  簡   ȸ ִ 
+	{
+		bon::map<int, int> target(values.begin(), values.end());
+		benchmark::report("bon::map find", benchmark::measure([&] {
+			long long sum = 0;
+			for (int key : writes)
+				sum += (target.find(key) != target.end()) ? 1 : 0;
+			benchmark::doNotOptimize(sum);
+		}));
+	}
+	{
+		bon::persistent_map<int, int> target(values.begin(), values.end());
+		benchmark::report("bon::persistent_map find", benchmark::measure([&] {
+			long long sum = 0;
+			for (int key : writes)
+				sum += target.contains(key) ? 1 : 0;
+			benchmark::doNotOptimize(sum);
+		}));
+	}
+}
\ No newline at end of file
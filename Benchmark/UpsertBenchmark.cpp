@@ -0,0 +1,48 @@
+#include <map>
+#include <random>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../DataStructure/map.hpp"
+
+namespace {
+	const int UPDATE_COUNT = 4000000;
+	const int KEY_COUNT = 200000;
+
+	template <class map, class Update>
+	void measureCounter(const char *name, const std::vector<int> &keys, Update update) {
+		benchmark::report(name, benchmark::measure([&] {
+			map target;
+			for (int key : keys)
+				update(target, key);
+			benchmark::doNotOptimize(target.size());
+		}));
+	}
+}
+
+// ī  (Ű  0 ְ 1 )
+void benchmarkUpsert() {
+	std::mt19937 random(42);
+
+	std::vector<int> keys(UPDATE_COUNT);
+	for (auto &key : keys)
+		key = static_cast<int>(random() % KEY_COUNT);
+
+	benchmark::title("upsert: 4M counter updates over 200K keys");
+	measureCounter<bon::map<int, int>>("bon::map find + insert", keys, [](bon::map<int, int> &target, int key) {
+		auto iter = target.find(key);
+		if (iter != target.end())
+			iter->second++;
+		else
+			target.insert(std::make_pair(key, 1));
+	});
+	measureCounter<bon::map<int, int>>("bon::map operator[]", keys, [](bon::map<int, int> &target, int key) {
+		target[key]++;
+	});
+	measureCounter<bon::map<int, int, std::less<int>, bon::compact_storage>>("bon::map (compact) operator[]", keys, [](bon::map<int, int, std::less<int>, bon::compact_storage> &target, int key) {
+		target[key]++;
+	});
+	measureCounter<std::map<int, int>>("std::map operator[]", keys, [](std::map<int, int> &target, int key) {
+		target[key]++;
+	});
+}
\ No newline at end of file
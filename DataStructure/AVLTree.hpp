@@ -1,122 +1,141 @@
 #pragma once
 
+#include <algorithm>
 #include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "balance_policy.hpp"
+#include "pool_allocator.hpp"
+#include "thread_pool.hpp"
+#include "tree_traits.hpp"
 
 namespace bon {
-	template <typename T, class Compare = std::less<T>>
+	//   å: node_data  忡 ߰Ǵ ʵ, update ڽ ٲ  ʵ带   ڽ ٽ 
+	struct no_augment {
+		struct node_data {
+		};
+
+		template <class Node, class Value>
+		static void update(Node *, const Value &) {
+		}
+	};
+	// κ Ʈ ũ⸦  (rank) k° (nth) O(log n) 
+	struct order_statistic {
+		struct node_data {
+			int size;
+		};
+
+		template <class Node, class Value>
+		static void update(Node *target, const Value &) {
+			int leftSize = (target->left != nullptr) ? target->left->size : 0;
+			int rightSize = (target->right != nullptr) ? target->right->size : 0;
+
+			target->size = leftSize + rightSize + 1;
+		}
+	};
+
+	// κ Ʈ ̵ 谪  (Monoid value_type  Լ identity(), lift(value), combine(left, right) )
+	// combine  Ģ ؾ ϸ, ȯ Ģ ʿ  (ʿ   )
+	template <class Monoid>
+	struct monoid_augment {
+		using monoid_type = Monoid;
+		using aggregate_type = typename Monoid::value_type;
+
+		struct node_data {
+			aggregate_type aggregate;
+		};
+
+		template <class Node, class Value>
+		static void update(Node *target, const Value &value) {
+			aggregate_type result = Monoid::lift(value);
+			if (target->left != nullptr)
+				result = Monoid::combine(target->left->aggregate, result);
+			if (target->right != nullptr)
+				result = Monoid::combine(result, target->right->aggregate);
+
+			target->aggregate = result;
+		}
+	};
+
+	template <class Augment, class = void>
+	struct HasAggregate : std::false_type {
+	};
+	template <class Augment>
+	struct HasAggregate<Augment, decltype(std::declval<typename Augment::node_data &>().aggregate, void())> : std::true_type {
+	};
+
+	template <class Augment, class = void>
+	struct HasSubtreeSize : std::false_type {
+	};
+	template <class Augment>
+	struct HasSubtreeSize<Augment, decltype(std::declval<typename Augment::node_data &>().size, void())> : std::true_type {
+	};
+
+	// Balance  å (avl_balance, wavl_balance, rb_balance, balance_policy.hpp )
+	template <typename T, class Compare = std::less<T>, class Allocator = pool_allocator<T>, class KeyOfValue = identity_key<T>, class Augment = no_augment, class Balance = avl_balance>
 	class AVLTree {
+	public:
+		using key_type = typename KeyOfValue::key_type;
+
 	protected:
-		class node {
+		//   node_data   Ŭ ũⰡ  
+		class node_base : public Augment::node_data {
 		public:
-			node(const T &value, node *parent) {
-				this->value = value;
-				this->parent = parent;
+			node_base() {
+				this->parent = nullptr;
 				this->left = nullptr;
 				this->right = nullptr;
-				this->height = 1;
-			}
-
-			int getBalance() {
-				int leftHeight = (left != nullptr) ? left->height : 0;
-				int rightHeight = (right != nullptr) ? right->height : 0;
-
-				return rightHeight - leftHeight;
+				this->height = 0;
 			}
-			void recalcHeight() {
-				int leftHeight = (left != nullptr) ? left->height : 0;
-				int rightHeight = (right != nullptr) ? right->height : 0;
 
-				height = (leftHeight > rightHeight) ? leftHeight+1 : rightHeight+1;
+			node_base *parent;
+			node_base *left, *right;
+			int height; //  å ũ (AVL , -  )
+		};
+		class node : public node_base {
+		public:
+			template <class... Args>
+			node(node_base *parent, Args &&...args) : value(std::forward<Args>(args)...) {
+				this->parent = parent;
+				this->height = 1;
 			}
 
 			T value;
-			node *parent;
-			node *left, *right;
-			int height;
 		};
 
+		using NodeAllocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+		using NodeTraits	= std::allocator_traits<NodeAllocator>;
+
 	public:
 		class iterator {
 		public:
-			using iterator_category = std::bidirectional_iterator_tag;
+			using iterator_category = std::conditional_t<HasSubtreeSize<Augment>::value, std::random_access_iterator_tag, std::bidirectional_iterator_tag>;
 			using value_type		= T;
 			using difference_type	= int;
 			using pointer			= T *;
 			using reference			= T &;
 
-			iterator() : iterator(nullptr, nullptr, nullptr) {
+			iterator() : curr(nullptr) {
 			}
-			iterator(node *curr) {
-				this->curr = curr;
-
-				if (curr == nullptr) {
-					prev = nullptr;
-					next = nullptr;
-					return;
-				}
-
-				if (curr->left != nullptr)
-					prev = GetMaxNode(curr->left);
-				else {
-					node *target = curr;
-					node *parent = target->parent;
-
-					while (parent != nullptr) {
-						if (parent->left == target) {
-							target = parent;
-							parent = target->parent;
-						}
-						else
-							break;
-					}
-
-					prev = parent;
-				}
-
-				if (curr->right != nullptr)
-					next = GetMinNode(curr->right);
-				else {
-					node *target = curr;
-					node *parent = target->parent;
-
-					while (parent != nullptr) {
-						if (parent->right == target) {
-							target = parent;
-							parent = target->parent;
-						}
-						else
-							break;
-					}
-
-					next = parent;
-				}
-			}
-			iterator(node *curr, node *prev, node *next)
-				: curr(curr), prev(prev), next(next) {
+			iterator(node_base *curr) : curr(curr) {
 			}
 			
 			iterator &operator++() {
-				prev = curr;
-				curr = next;
-
-				if (curr == nullptr)
-					next = nullptr;
-				else if (curr->right != nullptr)
-					next = GetMinNode(curr->right);
+				if (curr->right != nullptr)
+					curr = GetMinNode(curr->right);
 				else {
-					node *target = curr;
-					node *parent = target->parent;
-
-					while (parent != nullptr) {
-						if (parent->right == target) {
-							target = parent;
-							parent = target->parent;
-						}
-						else
-							break;
+					node_base *parent = curr->parent;
+
+					while (parent->right == curr) {
+						curr = parent;
+						parent = curr->parent;
 					}
 
-					next = parent;
+					curr = parent;
 				}
 
 				return *this;
@@ -127,27 +146,17 @@ namespace bon {
 				return result;
 			}
 			iterator &operator--() {
-				next = curr;
-				curr = prev;
-
-				if (curr == nullptr)
-					prev = nullptr;
-				else if (curr->left != nullptr)
-					prev = GetMaxNode(curr->left);
+				if (curr->left != nullptr)
+					curr = GetMaxNode(curr->left);
 				else {
-					node *target = curr;
-					node *parent = target->parent;
-
-					while (parent != nullptr) {
-						if (parent->left == target) {
-							target = parent;
-							parent = target->parent;
-						}
-						else
-							break;
+					node_base *parent = curr->parent;
+
+					while (parent != nullptr && parent->left == curr) {
+						curr = parent;
+						parent = curr->parent;
 					}
 
-					prev = parent;
+					curr = parent;
 				}
 
 				return *this;
@@ -158,6 +167,54 @@ namespace bon {
 				return result;
 			}
 
+			// κ Ʈ ũⰡ  ġ  O(log n) ̵
+			template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+			iterator &operator+=(difference_type offset) {
+				node_base *header;
+				int index = IndexOf(curr, header);
+				curr = NodeAt(header, index + offset);
+				return *this;
+			}
+			template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+			iterator &operator-=(difference_type offset) {
+				return *this += -offset;
+			}
+			template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+			iterator operator+(difference_type offset) const {
+				iterator result(*this);
+				return result += offset;
+			}
+			template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+			iterator operator-(difference_type offset) const {
+				iterator result(*this);
+				return result -= offset;
+			}
+			template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+			difference_type operator-(const iterator &iter) const {
+				node_base *header;
+				return IndexOf(curr, header) - IndexOf(iter.curr, header);
+			}
+			template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+			T &operator[](difference_type offset) const {
+				return *(*this + offset);
+			}
+			template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+			bool operator<(const iterator &iter) const {
+				return (*this - iter) < 0;
+			}
+			template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+			bool operator>(const iterator &iter) const {
+				return iter < *this;
+			}
+			template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+			bool operator<=(const iterator &iter) const {
+				return !(iter < *this);
+			}
+			template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+			bool operator>=(const iterator &iter) const {
+				return !(*this < iter);
+			}
+
 			bool operator==(const iterator &iter) const {
 				return this->curr == iter.curr;
 			}
@@ -166,324 +223,1231 @@ namespace bon {
 			}
 
 			T &operator*() const {
-				return curr->value;
+				return ValueOf(curr);
 			}
 			T *operator->() const {
-				return &(curr->value);
+				return &ValueOf(curr);
 			}
 
 		public:
-			node *prev, *next;
-			node *curr;
+			node_base *curr;
 		};
 
 	public:
-		AVLTree(bool bAllowDuplication = true) : compare(Compare()), bAllowDuplication(bAllowDuplication) {
-			root = nullptr;
+		AVLTree(bool bAllowDuplication = true, const Allocator &allocator = Allocator())
+			: compare(Compare()), nodeAllocator(allocator), bAllowDuplication(bAllowDuplication) {
 			length = 0;
+			rightmost = nullptr;
 		}
-		AVLTree(std::initializer_list<T> initList, bool bAllowDuplication = true) : AVLTree(initList.begin(), initList.end(), bAllowDuplication) {
+		AVLTree(std::initializer_list<T> initList, bool bAllowDuplication = true, const Allocator &allocator = Allocator())
+			: AVLTree(initList.begin(), initList.end(), bAllowDuplication, allocator) {
 		}
 		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
-		AVLTree(const _Iter &first, const _Iter &last, bool bAllowDuplication = true) : AVLTree(bAllowDuplication) {
+		AVLTree(const _Iter &first, const _Iter &last, bool bAllowDuplication = true, const Allocator &allocator = Allocator())
+			: AVLTree(bAllowDuplication, allocator) {
 			insert(first, last);
 		}
-		AVLTree(const AVLTree &tree) : AVLTree(tree.begin(), tree.end(), tree.bAllowDuplication) {
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		AVLTree(sorted_unique_t, const _Iter &first, const _Iter &last, bool bAllowDuplication = true, const Allocator &allocator = Allocator())
+			: AVLTree(bAllowDuplication, allocator) {
+			InsertSortedRange(first, last, typename std::iterator_traits<_Iter>::iterator_category());
+		}
+		//  :  Ҵ縸  ϰ,    Ʈ  
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		AVLTree(parallel_t policy, const _Iter &first, const _Iter &last, bool bAllowDuplication = true, const Allocator &allocator = Allocator())
+			: AVLTree(bAllowDuplication, allocator) {
+			ParallelInsertRange(policy.get(), first, last, typename std::iterator_traits<_Iter>::iterator_category());
+		}
+		AVLTree(const AVLTree &tree) : AVLTree(tree.bAllowDuplication) {
+			BuildSorted(tree.begin(), tree.end(), tree.size(), false);
+		}
+		AVLTree(AVLTree &&tree) noexcept
+			: compare(tree.compare), nodeAllocator(std::move(tree.nodeAllocator)), bAllowDuplication(tree.bAllowDuplication) {
+			length = 0;
+			rightmost = nullptr;
+			TakeNodes(tree);
 		}
 		~AVLTree() {
 			clear();
 		}
 
 		const AVLTree &operator=(const AVLTree &target) {
+			if (this == &target)
+				return *this;
+
 			clear();
 			bAllowDuplication = target.bAllowDuplication;
-			insert(target.begin(), target.end());
+			BuildSorted(target.begin(), target.end(), target.size(), false);
+			return *this;
+		}
+		const AVLTree &operator=(AVLTree &&target) {
+			if (this == &target)
+				return *this;
+
+			clear();
+			bAllowDuplication = target.bAllowDuplication;
+			MoveAssign(target, typename NodeTraits::propagate_on_container_move_assignment());
 			return *this;
 		}
 
 		iterator begin() const {
-			return !empty() ? iterator(GetMinNode(root)) : end();
+			return !empty() ? iterator(GetMinNode(header.left)) : end();
 		}
+		//  尡 end()  ϸ, Ʈ   ڽ
 		iterator end() const {
-			node *prev = GetMaxNode(root);
-			return iterator(nullptr, prev, nullptr);
+			return iterator(const_cast<node_base *>(&header));
 		}
 
-		virtual iterator find(const T &value) const {
-			node *curr = nullptr;
-			node *next = root;
-
-			while (next != nullptr) {
-				curr = next;
+		iterator find(const key_type &key) const {
+			return FindKey(key);
+		}
+		iterator lower_bound(const key_type &key) const {
+			return LowerBoundKey(key);
+		}
+		iterator upper_bound(const key_type &key) const {
+			return UpperBoundKey(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator find(const Key &key) const {
+			return FindKey(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator lower_bound(const Key &key) const {
+			return LowerBoundKey(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator upper_bound(const Key &key) const {
+			return UpperBoundKey(key);
+		}
 
-				bool bEqualCurr = areEqual(curr->value, value);
+		// index°(0) ,   end()
+		template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+		iterator nth(int index) const {
+			return iterator(NodeAt(const_cast<node_base *>(&header), index));
+		}
+		// key   
+		template <class A = Augment, std::enable_if_t<HasSubtreeSize<A>::value, int> = 0>
+		int rank(const key_type &key) const {
+			int result = 0;
+			node_base *curr = header.left;
+
+			while (curr != nullptr) {
+				if (compare(KeyOf(ValueOf(curr)), key)) { // curr->key < key
+					result += SizeOf(curr->left) + 1;
+					curr = curr->right;
+				}
+				else
+					curr = curr->left;
+			}
 
-				if (bEqualCurr) {
-					bool bEqualLeftChild = (curr->left != nullptr && areEqual(curr->left->value, value));
+			return result;
+		}
 
-					if (bEqualLeftChild)
-						next = curr->left;
-					else
-						break;
+		// ü  谪
+		template <class A = Augment, std::enable_if_t<HasAggregate<A>::value, int> = 0>
+		typename A::aggregate_type aggregate() const {
+			using Monoid = typename A::monoid_type;
+			return (header.left != nullptr) ? header.left->aggregate : Monoid::identity();
+		}
+		// Ű [lower, upper)   谪
+		template <class A = Augment, std::enable_if_t<HasAggregate<A>::value, int> = 0>
+		typename A::aggregate_type aggregate(const key_type &lower, const key_type &upper) const {
+			using Monoid = typename A::monoid_type;
+
+			//   Ž ΰ  带 ã
+			node_base *split = header.left;
+			while (split != nullptr) {
+				if (compare(KeyOf(ValueOf(split)), lower)) // split->key < lower
+					split = split->right;
+				else if (!compare(KeyOf(ValueOf(split)), upper)) // upper <= split->key
+					split = split->left;
+				else
+					break;
+			}
+			if (split == nullptr)
+				return Monoid::identity();
+
+			//  Ʈ lower ̻ κ
+			typename A::aggregate_type leftPart = Monoid::identity();
+			for (node_base *curr = split->left; curr != nullptr; ) {
+				if (compare(KeyOf(ValueOf(curr)), lower))
+					curr = curr->right;
+				else {
+					typename A::aggregate_type part = Monoid::lift(ValueOf(curr));
+					if (curr->right != nullptr)
+						part = Monoid::combine(part, curr->right->aggregate);
+					leftPart = Monoid::combine(part, leftPart);
+					curr = curr->left;
 				}
+			}
+
+			//  Ʈ upper ̸ κ
+			typename A::aggregate_type rightPart = Monoid::identity();
+			for (node_base *curr = split->right; curr != nullptr; ) {
+				if (!compare(KeyOf(ValueOf(curr)), upper))
+					curr = curr->left;
 				else {
-					next = (compare(value, curr->value)) ? curr->left : curr->right;
+					typename A::aggregate_type part = Monoid::lift(ValueOf(curr));
+					if (curr->left != nullptr)
+						part = Monoid::combine(curr->left->aggregate, part);
+					rightPart = Monoid::combine(rightPart, part);
+					curr = curr->right;
 				}
 			}
 
-			bool bExistValue = (curr != nullptr && areEqual(curr->value, value));
+			return Monoid::combine(Monoid::combine(leftPart, Monoid::lift(ValueOf(split))), rightPart);
+		}
 
-			return bExistValue ? iterator(curr) : end();
+		void insert(const T &value) {
+			InsertValue(value);
+		}
+		void insert(T &&value) {
+			InsertValue(std::move(value));
+		}
+		// hint ٷ տ  (hint   Ʈ Ž), Ե ҳ ̹ ִ  Ҹ ȯ
+		iterator insert(const iterator &hint, const T &value) {
+			return InsertValue(hint.curr, value);
+		}
+		iterator insert(const iterator &hint, T &&value) {
+			return InsertValue(hint.curr, std::move(value));
 		}
-		virtual iterator lower_bound(const T &value) const {
-			node *curr = nullptr;
-			node *next = root;
+		//   ġ   hint  (ĵ Է̸ Ҹ  ѵ )
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		void insert(const _Iter &first, const _Iter &last) {
+			if (empty()) {
+				InsertRange(first, last, typename std::iterator_traits<_Iter>::iterator_category());
+				return;
+			}
 
-			while (next != nullptr) {
-				curr = next;
+			InsertEach(first, last);
+		}
+		template <class... Args>
+		void emplace(Args &&...args) {
+			node *newNode = CreateNode(nullptr, std::forward<Args>(args)...);
+
+			node_base *parent, *equal;
+			bool bLeft;
+			if (!FindInsertPosition(KeyOf(newNode->value), parent, bLeft, equal)) {
+				DestroyNode(newNode);
+				return;
+			}
 
-				bool bEqualCurr = areEqual(curr->value, value);
+			AttachNode(newNode, parent, bLeft);
+		}
+		template <class... Args>
+		iterator emplace_hint(const iterator &hint, Args &&...args) {
+			node *newNode = CreateNode(nullptr, std::forward<Args>(args)...);
+
+			node_base *parent, *equal;
+			bool bLeft;
+			if (!FindHintPosition(hint.curr, KeyOf(newNode->value), parent, bLeft, equal))
+				FindInsertPosition(KeyOf(newNode->value), parent, bLeft, equal);
+
+			if (equal != nullptr) {
+				DestroyNode(newNode);
+				return iterator(equal);
+			}
 
-				if (bEqualCurr) {
-					bool bEqualRightChild = (curr->right != nullptr && areEqual(curr->right->value, value));
+			AttachNode(newNode, parent, bLeft);
+			return iterator(newNode);
+		}
 
-					if (bEqualRightChild)
-						next = curr->right;
-					else
-						break;
-				}
-				else
-					next = (compare(value, curr->value)) ? curr->left : curr->right;
+		void erase(const key_type &key) {
+			// ߺ  ƾ ϳ̹Ƿ   Ž
+			if (!bAllowDuplication) {
+				iterator iter = FindKey(key);
+				if (iter.curr != &header)
+					EraseNode(iter.curr);
+				return;
 			}
 
+			iterator iter = LowerBoundKey(key);
+			iterator last = UpperBoundKey(key);
+
+			while (iter != last)
+				iter = erase(iter);
+		}
+		iterator erase(const iterator where) {
+			iterator nextIter = where;
+			++nextIter;
+			EraseNode(where.curr);
+			return nextIter;
+		}
+		iterator erase(const iterator &first, const iterator &last) {
 			iterator iter;
-			if (curr != nullptr) {
-				iter = iterator(curr);
-				if (!areEqual(curr->value, value) && compare(curr->value, value)) // curr->value < value
-					++iter;
+			for (iter = first; iter != last; )
+				iter = erase(iter);
+			return iter;
+		}
+
+		inline int size() const {
+			return length;
+		}
+		inline bool empty() const {
+			return header.left == nullptr;
+		}
+		void clear() {
+			ClearNodes(HasRelease<NodeAllocator>());
+			header.left = nullptr;
+			rightmost = nullptr;
+			length = 0;
+		}
+		// Ʈ   (Ǯ Ҵڴ  ķ ҸŲ  ûũ   ȯ)
+		void clear(parallel_t policy) {
+			ParallelClearNodes(policy.get(), HasRelease<NodeAllocator>());
+			header.left = nullptr;
+			rightmost = nullptr;
+			length = 0;
+		}
+
+		// key ̻ Ҹ right ű,  Ʈ key ̸ Ҹ  (right  Ҵ )
+		// Ʈ ũ(order_statistic)    ũ⸦     ŭ ð  
+		void split(const key_type &key, AVLTree &right) {
+			if (this == &right)
+				return;
+
+			right.clear();
+
+			int oldLength = length;
+			node_base *lower, *upper;
+			SplitLower(header.left, key, lower, upper);
+			int upperLength = CountUpper(lower, upper, oldLength, HasSubtreeSize<Augment>());
+			SetRoot(lower, oldLength - upperLength);
+			try {
+				upper = right.AdoptNodes(upper, *this);
 			}
-			else
-				iter = end();
+			catch (...) {
+				//   带 ٽ ٿ  Ʈ ǵ
+				SetRoot(JoinNodes(header.left, upper), oldLength);
+				throw;
+			}
+			right.SetRoot(upper, upperLength);
+		}
+		// right Ҹ  ڿ ̾  (right  Ű  Ʈ Ű Ŀ ), right 
+		void join(AVLTree &&right) {
+			if (this == &right || right.empty())
+				return;
 
-			return iter;
+			if (!empty()) {
+				const key_type &lastKey = KeyOf(ValueOf(rightmost));
+				const key_type &firstKey = KeyOf(ValueOf(GetMinNode(right.header.left)));
+				if (bAllowDuplication ? compare(firstKey, lastKey) : !compare(lastKey, firstKey))
+					throw new std::runtime_error("join() called with overlapping keys");
+			}
+
+			int newLength = length + right.length;
+			node_base *rightRoot = TakeRoot(right);
+			SetRoot(JoinNodes(header.left, rightRoot), newLength);
+		}
+
+		//   ߺ  ʴ Ʈ(set, map)  ϸ, other 带 ϰ other 
+		// :  Ű   Ʈ Ҹ 
+		void set_union(AVLTree &&other) {
+			MergeWith(other, &AVLTree::UnionNodes, nullptr);
+		}
+		// :  Ʈ  ִ Ű  (Ҵ  Ʈ  )
+		void set_intersection(AVLTree &&other) {
+			MergeWith(other, &AVLTree::IntersectNodes, nullptr);
+		}
+		// : other ִ Ű  Ʈ 
+		void set_difference(AVLTree &&other) {
+			MergeWith(other, &AVLTree::DifferenceNodes, nullptr);
+		}
+
+		//  : 尡 PARALLEL_SIZE ̻ Ǵ Ʈ ͸ ۾ ġ Ǯ  
+		void set_union(parallel_t policy, AVLTree &&other) {
+			MergeWith(other, &AVLTree::UnionNodes, &policy.get());
 		}
-		virtual iterator upper_bound(const T &value) const {
-			auto iter = lower_bound(value);
-			if (areEqual(*iter, value))
-				++iter;
+		void set_intersection(parallel_t policy, AVLTree &&other) {
+			MergeWith(other, &AVLTree::IntersectNodes, &policy.get());
+		}
+		void set_difference(parallel_t policy, AVLTree &&other) {
+			MergeWith(other, &AVLTree::DifferenceNodes, &policy.get());
+		}
+
+	protected:
+		// Ű Ž (Key key_type Ǵ  ڰ ޴ Ÿ)
+		//  ܰ迡 񱳴   ϰ,    带 
+		template <class Key>
+		iterator FindKey(const Key &key) const {
+			iterator iter = LowerBoundKey(key);
+			if (iter == end() || compare(key, KeyOf(*iter))) // key < iter->key
+				return end();
 			return iter;
 		}
+		template <class Key>
+		iterator LowerBoundKey(const Key &key) const {
+			node_base *result = const_cast<node_base *>(&header);
+			node_base *curr = header.left;
+
+			while (curr != nullptr) {
+				if (!compare(KeyOf(ValueOf(curr)), key)) { // key <= curr->key
+					result = curr;
+					curr = curr->left;
+				}
+				else
+					curr = curr->right;
+			}
+
+			return iterator(result);
+		}
+		template <class Key>
+		iterator UpperBoundKey(const Key &key) const {
+			node_base *result = const_cast<node_base *>(&header);
+			node_base *curr = header.left;
+
+			while (curr != nullptr) {
+				if (compare(key, KeyOf(ValueOf(curr)))) { // key < curr->key
+					result = curr;
+					curr = curr->left;
+				}
+				else
+					curr = curr->right;
+			}
 
-		virtual void insert(const T &value) {
-			if (root == nullptr) {
-				root = new node(value, nullptr);
+			return iterator(result);
+		}
+
+		template <class V>
+		void InsertValue(V &&value) {
+			node_base *parent, *equal;
+			bool bLeft;
+			if (!FindInsertPosition(KeyOf(value), parent, bLeft, equal))
 				return;
+
+			//    
+			AttachNode(CreateNode(parent, std::forward<V>(value)), parent, bLeft);
+		}
+		template <class V>
+		iterator InsertValue(node_base *hint, V &&value) {
+			node_base *parent, *equal;
+			bool bLeft;
+			if (!FindHintPosition(hint, KeyOf(value), parent, bLeft, equal))
+				FindInsertPosition(KeyOf(value), parent, bLeft, equal);
+			if (equal != nullptr)
+				return iterator(equal);
+
+			node *newNode = CreateNode(parent, std::forward<V>(value));
+			AttachNode(newNode, parent, bLeft);
+			return iterator(newNode);
+		}
+		// key ڸ   Ž,  Ű    ڸ args    (ߺ     ҿ false)
+		template <class... Args>
+		std::pair<iterator, bool> EmplaceKey(const key_type &key, Args &&...args) {
+			node_base *parent, *equal;
+			bool bLeft;
+			if (!FindInsertPosition(key, parent, bLeft, equal))
+				return std::make_pair(iterator(equal), false);
+
+			node *newNode = CreateNode(parent, std::forward<Args>(args)...);
+			AttachNode(newNode, parent, bLeft);
+			return std::make_pair(iterator(newNode), true);
+		}
+		template <class _Iter>
+		void InsertEach(const _Iter &first, const _Iter &last) {
+			iterator hint = end();
+			for (auto targetIter = first; targetIter != last; targetIter++) {
+				hint = InsertValue(hint.curr, *targetIter);
+				++hint;
 			}
+		}
+		// hint(̸ ) ٷ  key ڸ ̿   Ȯϰ,  Ž  ġ 
+		// ߺ   ̿  Ű  equal 
+		bool FindHintPosition(node_base *hint, const key_type &key, node_base *&parent, bool &bLeft, node_base *&equal) const {
+			equal = nullptr;
+			if (header.left == nullptr)
+				return false;
+
+			node_base *prev;
+			if (hint == &header)
+				prev = rightmost;
+			else {
+				if (compare(KeyOf(ValueOf(hint)), key))
+					return false;
+				if (!bAllowDuplication && !compare(key, KeyOf(ValueOf(hint)))) {
+					equal = hint;
+					return true;
+				}
+
+				// hint    nullptr
+				iterator prevIter(hint);
+				prev = (--prevIter).curr;
+			}
+
+			if (prev != nullptr) {
+				if (compare(key, KeyOf(ValueOf(prev))))
+					return false;
+				if (!bAllowDuplication && !compare(KeyOf(ValueOf(prev)), key)) {
+					equal = prev;
+					return true;
+				}
+			}
+
+			//   ̿    ϳ  ڽ ڸ  
+			if (prev != nullptr && prev->right == nullptr) {
+				parent = prev;
+				bLeft = false;
+			}
+			else {
+				parent = hint;
+				bLeft = true;
+			}
+			return true;
+		}
+		//  ġ Ž (ߺ    Ű  equal  false)
+		bool FindInsertPosition(const key_type &key, node_base *&parent, bool &bLeft, node_base *&equal) const {
+			parent = const_cast<node_base *>(&header);
+			bLeft = true;
+			equal = nullptr;
 
-			//  ġ Ž
-			node *curr = nullptr;
-			node *next = root;
+			//     (value   ū )
+			node_base *notGreater = nullptr;
+
+			node_base *next = header.left;
 			while (next != nullptr) {
-				curr = next;
-				if (!bAllowDuplication && areEqual(curr->value, value)) return; // ߺ 
-				next = (compare(value, curr->value)) ? curr->left : curr->right;
+				parent = next;
+				bLeft = compare(key, KeyOf(ValueOf(parent)));
+				if (bLeft)
+					next = parent->left;
+				else {
+					notGreater = parent;
+					next = parent->right;
+				}
 			}
 
-			//    
-			node *newNode = new node(value, curr);
-			if (compare(value, curr->value))
-				curr->left = newNode;
+			// ߺ 
+			if (!bAllowDuplication && notGreater != nullptr && !compare(KeyOf(ValueOf(notGreater)), key)) {
+				equal = notGreater;
+				return false;
+			}
+
+			return true;
+		}
+		void AttachNode(node_base *newNode, node_base *parent, bool bLeft) {
+			newNode->parent = parent;
+			if (bLeft)
+				parent->left = newNode;
 			else
-				curr->right = newNode;
+				parent->right = newNode;
 			length++;
+			if (parent == &header || (parent == rightmost && !bLeft))
+				rightmost = newNode;
+			Augment::update(newNode, ValueOf(newNode));
+
+			Balance::insert_fixup(newNode, &header, NodeUpdate());
+			UpdateToRoot(newNode, std::is_empty<typename Augment::node_data>());
+		}
+		void EraseNode(node_base *curr) {
+			//  ū   ڽ Ƿ ٷ    Ʈ ִ  Ǵ θ
+			if (curr == rightmost)
+				rightmost = (curr->left != nullptr) ? GetMaxNode(curr->left) : ((curr->parent != &header) ? curr->parent : nullptr);
+			node_base *target = UnlinkNode(curr);
+
+			//  
+			DestroyNode(curr);
+			length--;
 
 			// Ʈ 뷱 
-			node *target = curr;
-			while ((target = GetUnbalancedNodeWithRecalcHeight(target)) != nullptr) {
-				target = MaintainBalance(target);
-				if (target->parent == nullptr)
-					root = target;
+			Balance::erase_fixup(target, &header, NodeUpdate());
+			UpdateToRoot(target, std::is_empty<typename Augment::node_data>());
+		}
+		//  带 Ʈ   ̸ ٽ ϱ  带 ȯ
+		// ڽ ̸ ļ ( Ʈ ּ ,  ڽ )   Ű  ڸ ä
+		node_base *UnlinkNode(node_base *target) {
+			node_base *parent = target->parent;
+			node_base *&link = (parent->left == target) ? parent->left : parent->right;
+
+			if (target->left == nullptr || target->right == nullptr) {
+				node_base *child = (target->left != nullptr) ? target->left : target->right;
+				link = child;
+				if (child != nullptr)
+					child->parent = parent;
+				return parent;
+			}
+
+			node_base *successor = GetMinNode(target->right);
+			node_base *retraceFrom = successor;
+			if (successor != target->right) {
+				// ļ  ڸ   ڽ ä
+				retraceFrom = successor->parent;
+				retraceFrom->left = successor->right;
+				if (successor->right != nullptr)
+					successor->right->parent = retraceFrom;
+
+				successor->right = target->right;
+				successor->right->parent = successor;
 			}
+
+			successor->left = target->left;
+			successor->left->parent = successor;
+			successor->parent = parent;
+			successor->height = target->height; //  ö󰡸  ȭ  
+			link = successor;
+
+			return retraceFrom;
 		}
-		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
-		void insert(const _Iter &first, const _Iter &last) {
-			for (auto targetIter = first; targetIter != last; targetIter++)
-				insert(*targetIter);
+		//  å ȸ    ϹǷ, / ġ Ʈ ٽ  (ũ, 谪)
+		void UpdateToRoot(node_base *, std::true_type) {
+		}
+		void UpdateToRoot(node_base *target, std::false_type) {
+			for (; target != &header; target = target->parent)
+				Augment::update(target, ValueOf(target));
+		}
+		//  å ڽ ٲ    ٽ   
+		struct NodeUpdate {
+			void operator()(node_base *target) const {
+				Augment::update(target, ValueOf(target));
+			}
+		};
+
+		// 带 ° Ѱܹ (Ʈ θ  Ʈ  )
+		void TakeNodes(AVLTree &target) {
+			header.left = target.header.left;
+			length = target.length;
+			rightmost = target.rightmost;
+			if (header.left != nullptr)
+				header.left->parent = &header;
+
+			target.header.left = nullptr;
+			target.rightmost = nullptr;
+			target.length = 0;
+		}
+		void MoveAssign(AVLTree &target, std::true_type) {
+			nodeAllocator = std::move(target.nodeAllocator);
+			TakeNodes(target);
 		}
+		void MoveAssign(AVLTree &target, std::false_type) {
+			if (nodeAllocator == target.nodeAllocator) {
+				TakeNodes(target);
+				return;
+			}
 
-		virtual void erase(const T &value) {
-			iterator iter = find(value);
+			// Ҵڰ ٸ   ̵
+			BuildSorted(std::make_move_iterator(target.begin()), std::make_move_iterator(target.end()), target.size(), false);
+			target.clear();
+		}
 
-			while (iter != end() && areEqual(*iter, value))
-				iter = erase(iter);
+		template <class... Args>
+		node *CreateNode(node_base *parent, Args &&...args) {
+			node *newNode = NodeTraits::allocate(nodeAllocator, 1);
+			try {
+				NodeTraits::construct(nodeAllocator, newNode, parent, std::forward<Args>(args)...);
+			}
+			catch (...) {
+				NodeTraits::deallocate(nodeAllocator, newNode, 1);
+				throw;
+			}
+			return newNode;
+		}
+		void DestroyNode(node_base *target) {
+			node *doomed = static_cast<node *>(target);
+			NodeTraits::destroy(nodeAllocator, doomed);
+			NodeTraits::deallocate(nodeAllocator, doomed, 1);
 		}
-		virtual iterator erase(const iterator where) {
-			node *nextNode = where.next;
-			node *curr = where.curr;
+		void DestroySubtree(node_base *target) {
+			if (target == nullptr)
+				return;
 
-			//  带 ܸ  ̵
-			while (true) {
-				bool isLeaf = curr->left == nullptr && curr->right == nullptr;
-				if (isLeaf) break;
+			DestroySubtree(target->left);
+			DestroySubtree(target->right);
+			DestroyNode(target);
+		}
 
-				node *swapTarget;
-				if (curr->left != nullptr)
-					swapTarget = GetMaxNode(curr->left);
+		//  ȸ 带  ( )
+		void ClearNodes(std::false_type) {
+			DestroySubtree(header.left);
+		}
+		// Ǯ Ҵڴ  ҸŲ  ûũ   ȯ
+		void ClearNodes(std::true_type) {
+			DestroyValues(header.left, std::is_trivially_destructible<node>());
+			nodeAllocator.release();
+		}
+		void DestroyValues(node_base *, std::true_type) {
+		}
+		void DestroyValues(node_base *target, std::false_type) {
+			if (target == nullptr)
+				return;
+
+			DestroyValues(target->left, std::false_type());
+			DestroyValues(target->right, std::false_type());
+			NodeTraits::destroy(nodeAllocator, static_cast<node *>(target));
+		}
+
+		//  Ʈ   , ĵ Է̸ O(n) 
+		template <class _Iter>
+		void InsertRange(const _Iter &first, const _Iter &last, std::input_iterator_tag) {
+			InsertEach(first, last);
+		}
+		template <class _Iter>
+		void InsertRange(const _Iter &first, const _Iter &last, std::forward_iterator_tag) {
+			int count = 0;
+			bool bSkipEqual = false;
+
+			if (!CountSortedRange(first, last, count, bSkipEqual)) {
+				InsertEach(first, last);
+				return;
+			}
+
+			BuildSorted(first, last, count, bSkipEqual);
+		}
+		template <class _Iter>
+		void InsertSortedRange(const _Iter &first, const _Iter &last, std::input_iterator_tag) {
+			InsertEach(first, last);
+		}
+		template <class _Iter>
+		void InsertSortedRange(const _Iter &first, const _Iter &last, std::forward_iterator_tag) {
+			BuildSorted(first, last, static_cast<int>(std::distance(first, last)), false);
+		}
+
+		//  ο Ʈ     (ߺ     ù ° )
+		template <class _Iter>
+		bool CountSortedRange(_Iter first, const _Iter &last, int &count, bool &bSkipEqual) const {
+			count = 0;
+			bSkipEqual = false;
+			if (first == last)
+				return true;
+
+			_Iter prev = first;
+			count = 1;
+			for (++first; first != last; prev = first, ++first) {
+				if (compare(KeyOf(*first), KeyOf(*prev)))
+					return false;
+
+				if (bAllowDuplication || compare(KeyOf(*prev), KeyOf(*first)))
+					count++;
 				else
-					swapTarget = GetMinNode(curr->right);
+					bSkipEqual = true;
+			}
+
+			return true;
+		}
+
+		// ĵ   Է ٷ  ,  ܿ    
+		template <class _Iter>
+		void ParallelInsertRange(thread_pool &pool, const _Iter &first, const _Iter &last, std::random_access_iterator_tag) {
+			int count = 0;
+			bool bSkipEqual = false;
+
+			if (CountSortedRange(first, last, count, bSkipEqual) && !bSkipEqual) {
+				ParallelBuildSorted(pool, first, count);
+				return;
+			}
+
+			ParallelInsertRange(pool, first, last, std::input_iterator_tag());
+		}
+		template <class _Iter>
+		void ParallelInsertRange(thread_pool &pool, const _Iter &first, const _Iter &last, std::input_iterator_tag) {
+			std::vector<T> values(first, last);
+			auto lessValue = [this](const T &left, const T &right) {
+				return compare(KeyOf(left), KeyOf(right));
+			};
+
+			//  ̶  Ű Է  ǰ, ߺ   ù °  (insert ݺ  )
+			ParallelSort(pool, values.begin(), values.end(), lessValue);
+			if (!bAllowDuplication) {
+				auto newEnd = std::unique(values.begin(), values.end(), [&](const T &left, const T &right) {
+					return !lessValue(left, right);
+				});
+				values.erase(newEnd, values.end());
+			}
 
-				SwapNode(curr, swapTarget);
-				if (curr == root)
-					root = swapTarget;
+			ParallelBuildSorted(pool, std::make_move_iterator(values.begin()), static_cast<int>(values.size()));
+		}
+		template <class _Iter, class Less>
+		static void ParallelSort(thread_pool &pool, const _Iter &first, const _Iter &last, const Less &less) {
+			if (last - first <= PARALLEL_CUTOFF) {
+				std::stable_sort(first, last, less);
+				return;
 			}
 
-			//   θ ڽİ 
-			node *parent = curr->parent;
-			if (parent == nullptr)
-				root = nullptr;
+			_Iter middle = first + (last - first) / 2;
+			pool.invoke([&] { ParallelSort(pool, first, middle, less); }, [&] { ParallelSort(pool, middle, last, less); });
+			std::inplace_merge(first, middle, last, less);
+		}
+		template <class _Iter>
+		void ParallelBuildSorted(thread_pool &pool, const _Iter &first, int count) {
+			if (count == 0)
+				return;
+
+			// Ҵڴ     Ƿ  ̸  Ҵ
+			std::vector<node *> nodes;
+			std::vector<char> constructed(count, 0);
+			nodes.reserve(count);
+			try {
+				for (int i = 0; i < count; i++)
+					nodes.push_back(NodeTraits::allocate(nodeAllocator, 1));
+
+				SetRoot(ParallelBuildSubtree(pool, first, nodes.data(), constructed.data(), 0, count), count);
+			}
+			catch (...) {
+				for (int i = 0; i < static_cast<int>(nodes.size()); i++) {
+					if (constructed[i])
+						NodeTraits::destroy(nodeAllocator, nodes[i]);
+					NodeTraits::deallocate(nodeAllocator, nodes[i], 1);
+				}
+				throw;
+			}
+		}
+		//   [begin, end)    Ʈ 
+		template <class _Iter>
+		node_base *ParallelBuildSubtree(thread_pool &pool, const _Iter &first, node **nodes, char *constructed, int begin, int end) {
+			if (begin == end)
+				return nullptr;
+
+			int middle = begin + (end - begin) / 2;
+			node_base *left, *right;
+			if (end - begin > PARALLEL_CUTOFF) {
+				pool.invoke([&] { left = ParallelBuildSubtree(pool, first, nodes, constructed, begin, middle); },
+					[&] { right = ParallelBuildSubtree(pool, first, nodes, constructed, middle + 1, end); });
+			}
 			else {
-				node *&child = ((parent->left == curr) ? parent->left : parent->right);
-				child = nullptr;
+				left = ParallelBuildSubtree(pool, first, nodes, constructed, begin, middle);
+				right = ParallelBuildSubtree(pool, first, nodes, constructed, middle + 1, end);
 			}
 
-			//  
-			delete curr;
-			length--;
+			NodeTraits::construct(nodeAllocator, nodes[middle], nullptr, first[middle]);
+			constructed[middle] = 1;
+			return Link(left, nodes[middle], right);
+		}
 
-			// Ʈ 뷱 
-			node *target = parent;
-			while ((target = GetUnbalancedNodeWithRecalcHeight(target)) != nullptr) {
-				target = MaintainBalance(target);
-				if (target->parent == nullptr)
-					root = target;
+		void ParallelClearNodes(thread_pool &pool, std::true_type) {
+			if (!std::is_trivially_destructible<node>::value)
+				ParallelDestroy(pool, header.left, true);
+			nodeAllocator.release();
+		}
+		//   Ҵ(׻ )  忡 ,  ܿ  
+		void ParallelClearNodes(thread_pool &pool, std::false_type) {
+			if (NodeTraits::is_always_equal::value)
+				ParallelDestroy(pool, header.left, false);
+			else
+				ClearNodes(std::false_type());
+		}
+		void ParallelDestroy(thread_pool &pool, node_base *target, bool bValuesOnly) {
+			if (target == nullptr)
+				return;
+
+			if (IsParallelSize(target))
+				pool.invoke([&] { ParallelDestroy(pool, target->left, bValuesOnly); }, [&] { ParallelDestroy(pool, target->right, bValuesOnly); });
+			else if (bValuesOnly) {
+				DestroyValues(target->left, std::false_type());
+				DestroyValues(target->right, std::false_type());
+			}
+			else {
+				DestroySubtree(target->left);
+				DestroySubtree(target->right);
 			}
 
-			return iterator(nextNode);
+			if (bValuesOnly)
+				NodeTraits::destroy(nodeAllocator, static_cast<node *>(target));
+			else
+				DestroyNode(target);
 		}
-		virtual iterator erase(const iterator &first, const iterator &last) {
-			iterator iter;
-			for (iter = first; iter != last; )
-				iter = erase(iter);
-			return iter;
+
+		template <class _Iter>
+		void BuildSorted(_Iter first, const _Iter &last, int count, bool bSkipEqual) {
+			header.left = BuildSortedSubtree(first, last, count, bSkipEqual, &header);
+			rightmost = GetMaxNode(header.left);
+			length = count;
 		}
+		//   Է Һϸ   Ʈ 
+		template <class _Iter>
+		node_base *BuildSortedSubtree(_Iter &iter, const _Iter &last, int count, bool bSkipEqual, node_base *parent) {
+			if (count == 0)
+				return nullptr;
 
-		inline int size() const {
-			return length;
+			int leftCount = count / 2;
+			node_base *left = BuildSortedSubtree(iter, last, leftCount, bSkipEqual, nullptr);
+
+			node *curr;
+			try {
+				curr = CreateNode(parent, *iter);
+			}
+			catch (...) {
+				DestroySubtree(left);
+				throw;
+			}
+
+			_Iter prev = iter;
+			++iter;
+			if (bSkipEqual) {
+				while (iter != last && !compare(KeyOf(*prev), KeyOf(*iter)))
+					++iter;
+			}
+
+			curr->left = left;
+			if (left != nullptr)
+				left->parent = curr;
+
+			try {
+				curr->right = BuildSortedSubtree(iter, last, count - leftCount - 1, bSkipEqual, curr);
+			}
+			catch (...) {
+				DestroySubtree(curr->left);
+				DestroyNode(curr);
+				throw;
+			}
+
+			Balance::build_rank(curr);
+			Augment::update(curr, ValueOf(curr));
+			return curr;
 		}
-		inline bool empty() const {
-			return length == 0;
+
+		// ũ ǹ̴  å ٸǷ (AVL , -  ) å ϴ ּ ũ Ǵ
+		static bool IsParallelSize(node_base *target) {
+			static const int parallelRank = FindParallelRank();
+			return HeightOf(target) >= parallelRank;
 		}
-		void clear() {
-			erase(begin(), end());
+		static int FindParallelRank() {
+			int rank = 1;
+			while (Balance::min_size(rank) < PARALLEL_SIZE)
+				rank++;
+			return rank;
+		}
+		static int HeightOf(node_base *target) {
+			return (target != nullptr) ? target->height : 0;
 		}
+		//   ״ ߿ pivot Ʒ  Ʈ 
+		static node_base *Link(node_base *left, node_base *pivot, node_base *right) {
+			pivot->left = left;
+			pivot->right = right;
+			if (left != nullptr) left->parent = pivot;
+			if (right != nullptr) right->parent = pivot;
+
+			Balance::build_rank(pivot);
+			Augment::update(pivot, ValueOf(pivot));
+			return pivot;
+		}
+		// left < pivot < right  Ʈ O(|ũ |) ħ
+		static node_base *JoinNodes(node_base *left, node_base *pivot, node_base *right) {
+			return Balance::join(left, pivot, right, NodeUpdate());
+		}
+		//    ħ (left  带  pivot )
+		static node_base *JoinNodes(node_base *left, node_base *right) {
+			if (left == nullptr)
+				return right;
+			if (right == nullptr)
+				return left;
+
+			node_base *last;
+			node_base *rest = SplitLast(left, last);
+			return JoinNodes(rest, last, right);
+		}
+		static node_base *SplitLast(node_base *target, node_base *&last) {
+			if (target->right == nullptr) {
+				last = target;
+				return target->left;
+			}
 
-	protected:
-		static node *MaintainBalance(node *target) {
-			node *x, *y, *z;
-			node *a, *b, *c;
-			node *t0, *t1, *t2, *t3;
-
-			z = target;
-			if (z->getBalance() < 0) {
-				y = z->left;
-				if (y->getBalance() < 0) {
-					x = y->left;
-
-					a = x;
-					b = y;
-					c = z;
-
-					t0 = x->left;
-					t1 = x->right;
-					t2 = y->right;
-					t3 = z->right;
-				} else {
-					x = y->right;
-
-					a = y;
-					b = x;
-					c = z;
-
-					t0 = y->left;
-					t1 = x->left;
-					t2 = x->right;
-					t3 = z->right;
-				}
-			} else {
-				y = z->right;
-				if (y->getBalance() < 0) {
-					x = y->left;
-
-					a = z;
-					b = x;
-					c = y;
-
-					t0 = z->left;
-					t1 = x->left;
-					t2 = x->right;
-					t3 = y->right;
-				} else {
-					x = y->right;
-
-					a = z;
-					b = y;
-					c = x;
-
-					t0 = z->left;
-					t1 = y->left;
-					t2 = x->left;
-					t3 = x->right;
-				}
+			node_base *rest = SplitLast(target->right, last);
+			return JoinNodes(target->left, target, rest);
+		}
+		// key ̸ key ̻ 
+		void SplitLower(node_base *target, const key_type &key, node_base *&lower, node_base *&upper) const {
+			if (target == nullptr) {
+				lower = upper = nullptr;
+				return;
 			}
-			
-			node *parent = z->parent;
-
-			a->parent = b;
-			a->left = t0;
-			a->right = t1;
-			a->recalcHeight();
-			if (t0 != nullptr) t0->parent = a;
-			if (t1 != nullptr) t1->parent = a;
-
-			c->parent = b;
-			c->left = t2;
-			c->right = t3;
-			c->recalcHeight();
-			if (t2 != nullptr) t2->parent = c;
-			if (t3 != nullptr) t3->parent = c;
-
-			b->parent = parent;
-			b->left = a;
-			b->right = c;
-			b->recalcHeight();
-
-			if (parent != nullptr) {
-				if (parent->left == z)
-					parent->left = b;
-				else
-					parent->right = b;
+
+			node_base *left = target->left, *right = target->right;
+			if (compare(KeyOf(ValueOf(target)), key)) { // target->key < key
+				node_base *rest;
+				SplitLower(right, key, rest, upper);
+				lower = JoinNodes(left, target, rest);
+			}
+			else {
+				node_base *rest;
+				SplitLower(left, key, lower, rest);
+				upper = JoinNodes(rest, target, right);
+			}
+		}
+		// key ̸, key ʰ ϰ key  带 ȯ ( nullptr)
+		template <class Key>
+		node_base *SplitNodes(node_base *target, const Key &key, node_base *&lower, node_base *&upper) const {
+			if (target == nullptr) {
+				lower = upper = nullptr;
+				return nullptr;
 			}
 
-			return b;
+			node_base *left = target->left, *right = target->right;
+			node_base *middle, *rest;
+			if (compare(key, KeyOf(ValueOf(target)))) { // key < target->key
+				middle = SplitNodes(left, key, lower, rest);
+				upper = JoinNodes(rest, target, right);
+			}
+			else if (compare(KeyOf(ValueOf(target)), key)) { // target->key < key
+				middle = SplitNodes(right, key, rest, upper);
+				lower = JoinNodes(left, target, rest);
+			}
+			else {
+				lower = left;
+				upper = right;
+				if (lower != nullptr) lower->parent = nullptr;
+				if (upper != nullptr) upper->parent = nullptr;
+				middle = target;
+			}
+
+			return middle;
 		}
-		static node *GetUnbalancedNodeWithRecalcHeight(node *target) {
-			int leftHeight, rightHeight;
 
-			while (target != nullptr) {
-				leftHeight = (target->left != nullptr) ? target->left->height : 0;
-				rightHeight = (target->right != nullptr) ? target->right->height : 0;
+		//  꿡 ŵ  (  ߿ Ҵڸ ÿ  ʵ  ξٰ   )
+		struct removed_nodes {
+			explicit removed_nodes(bool bDefer) : count(0), bDefer(bDefer) {
+			}
 
-				int newHeight = (leftHeight > rightHeight) ? leftHeight+1 : rightHeight+1;
-				target->height = newHeight;
-				if (abs(leftHeight - rightHeight) >= 2)
-					break;
-				target = target->parent;
+			int count;
+			bool bDefer;
+			std::vector<node_base *> deferred;
+		};
+		void Remove(node_base *target, removed_nodes &removed) {
+			removed.count++;
+			if (removed.bDefer)
+				removed.deferred.push_back(target);
+			else
+				DestroyNode(target);
+		}
+		void RemoveSubtree(node_base *target, removed_nodes &removed) {
+			if (target == nullptr)
+				return;
+
+			RemoveSubtree(target->left, removed);
+			RemoveSubtree(target->right, removed);
+			Remove(target, removed);
+		}
+		// Ʈ  ũ   ȣ Ǯ ķ 
+		template <class Left, class Right>
+		void ForkJoin(thread_pool *pool, node_base *target, removed_nodes &removed, Left left, Right right) {
+			if (pool == nullptr || !IsParallelSize(target)) {
+				left(removed);
+				right(removed);
+				return;
 			}
 
-			return target;
+			removed_nodes rightRemoved(true);
+			pool->invoke([&] { left(removed); }, [&] { right(rightRemoved); });
+			removed.count += rightRemoved.count;
+			removed.deferred.insert(removed.deferred.end(), rightRemoved.deferred.begin(), rightRemoved.deferred.end());
+		}
+
+		// Ұ ġ⸦ ݺϴ   (first Ҹ )
+		node_base *UnionNodes(node_base *first, node_base *second, removed_nodes &removed, thread_pool *pool) {
+			if (first == nullptr)
+				return second;
+			if (second == nullptr)
+				return first;
+
+			node_base *lower, *upper;
+			node_base *same = SplitNodes(second, KeyOf(ValueOf(first)), lower, upper);
+			if (same != nullptr)
+				Remove(same, removed);
+
+			node_base *left = first->left, *right = first->right;
+			ForkJoin(pool, first, removed,
+				[&](removed_nodes &target) { left = UnionNodes(left, lower, target, pool); },
+				[&](removed_nodes &target) { right = UnionNodes(right, upper, target, pool); });
+			return JoinNodes(left, first, right);
 		}
+		node_base *IntersectNodes(node_base *first, node_base *second, removed_nodes &removed, thread_pool *pool) {
+			if (first == nullptr || second == nullptr) {
+				RemoveSubtree(first, removed);
+				RemoveSubtree(second, removed);
+				return nullptr;
+			}
+
+			node_base *lower, *upper;
+			node_base *same = SplitNodes(second, KeyOf(ValueOf(first)), lower, upper);
+
+			node_base *left = first->left, *right = first->right;
+			ForkJoin(pool, first, removed,
+				[&](removed_nodes &target) { left = IntersectNodes(left, lower, target, pool); },
+				[&](removed_nodes &target) { right = IntersectNodes(right, upper, target, pool); });
+
+			if (same != nullptr) {
+				Remove(same, removed);
+				return JoinNodes(left, first, right);
+			}
+
+			Remove(first, removed);
+			return JoinNodes(left, right);
+		}
+		node_base *DifferenceNodes(node_base *first, node_base *second, removed_nodes &removed, thread_pool *pool) {
+			if (first == nullptr || second == nullptr) {
+				RemoveSubtree(second, removed);
+				return first;
+			}
+
+			node_base *lower, *upper;
+			node_base *same = SplitNodes(first, KeyOf(ValueOf(second)), lower, upper);
+
+			node_base *left = second->left, *right = second->right;
+			if (same != nullptr)
+				Remove(same, removed);
+
+			ForkJoin(pool, second, removed,
+				[&](removed_nodes &target) { lower = DifferenceNodes(lower, left, target, pool); },
+				[&](removed_nodes &target) { upper = DifferenceNodes(upper, right, target, pool); });
+
+			Remove(second, removed);
+			return JoinNodes(lower, upper);
+		}
+		void MergeWith(AVLTree &other, node_base *(AVLTree::*operation)(node_base *, node_base *, removed_nodes &, thread_pool *), thread_pool *pool) {
+			if (this == &other)
+				return;
 
-		static node *GetMinNode(node *target) {
+			int newLength = length + other.length;
+			node_base *otherRoot = TakeSmaller(other, HasSplice<NodeAllocator>());
+			node_base *root = header.left;
+			if (root != nullptr)
+				root->parent = nullptr;
+
+			removed_nodes removed(pool != nullptr);
+			root = (this->*operation)(root, otherRoot, removed, pool);
+			for (node_base *target : removed.deferred)
+				DestroyNode(target);
+
+			SetRoot(root, newLength - removed.count);
+		}
+
+		//       ̻ ð Ƿ   带 ū  Ǯ ű ū  Ǯ 
+		// Ǯ ° Ѱܹޱ⸸ ϸ 꿡  尡 ִ ûũ 긶 
+		node_base *TakeSmaller(AVLTree &other, std::true_type) {
+			if (other.empty() || nodeAllocator == other.nodeAllocator)
+				return TakeRoot(other);
+
+			if (other.length <= length) {
+				node_base *root = AdoptSubtree(other.header.left, other);
+				other.header.left = nullptr;
+				other.rightmost = nullptr;
+				other.length = 0;
+
+				root->parent = nullptr;
+				return root;
+			}
+
+			//  Ʈ 带 other Ǯ ű   Ʈ Ǯ  other Ǯ Ѱܹ ( Ǯ Ҵ  Ѱܹ)
+			SetRoot(other.AdoptSubtree(header.left, *this), length);
+			nodeAllocator.release();
+			return TakeRoot(other);
+		}
+		node_base *TakeSmaller(AVLTree &other, std::false_type) {
+			return TakeRoot(other);
+		}
+		// other 带     Ʈ Ҵ  
+		// 带 ű ߿ ܰ  other ״ 
+		node_base *TakeRoot(AVLTree &other) {
+			node_base *root = other.header.left;
+			if (root != nullptr && !NodeTraits::is_always_equal::value && nodeAllocator != other.nodeAllocator)
+				root = SpliceNodes(root, other, HasSplice<NodeAllocator>());
+			other.header.left = nullptr;
+			other.rightmost = nullptr;
+			other.length = 0;
+
+			if (root != nullptr)
+				root->parent = nullptr;
+			return root;
+		}
+		// Ǯ Ҵڴ other ûũ   ° Ѱܹ޾ 带 ״ 
+		node_base *SpliceNodes(node_base *root, AVLTree &other, std::true_type) {
+			nodeAllocator.splice(other.nodeAllocator);
+			return root;
+		}
+		node_base *SpliceNodes(node_base *root, AVLTree &other, std::false_type) {
+			return AdoptSubtree(root, other);
+		}
+		// ó owner 尡  : Ҵڰ ٸ (Ǯ Ҵڴ Ʈ ٸ) Ǯ   带 ״ ,
+		//     Ҵڸ   带  Ʈ  Ҵϰ  ű
+		node_base *AdoptNodes(node_base *root, AVLTree &owner) {
+			if (root == nullptr || NodeTraits::is_always_equal::value || nodeAllocator == owner.nodeAllocator)
+				return root;
+
+			return AdoptNodes(root, owner, HasShare<NodeAllocator>());
+		}
+		node_base *AdoptNodes(node_base *root, AVLTree &owner, std::true_type) {
+			nodeAllocator.share(owner.nodeAllocator);
+			return root;
+		}
+		node_base *AdoptNodes(node_base *root, AVLTree &owner, std::false_type) {
+			return AdoptSubtree(root, owner);
+		}
+		//  带   ڿ  带  (߿ ܰ   带 ǵ   ״)
+		node_base *AdoptSubtree(node_base *source, AVLTree &owner) {
+			node_base *copied = MoveSubtree(source);
+			owner.DestroySubtree(source);
+			return copied;
+		}
+		//  move_if_noexcept ű (̵ ܸ    ϹǷ   )
+		node_base *MoveSubtree(node_base *source) {
+			if (source == nullptr)
+				return nullptr;
+
+			node *newNode = CreateNode(nullptr, std::move_if_noexcept(ValueOf(source)));
+			newNode->height = source->height;
+			static_cast<typename Augment::node_data &>(*newNode) = static_cast<const typename Augment::node_data &>(*source);
+
+			try {
+				newNode->left = MoveSubtree(source->left);
+				newNode->right = MoveSubtree(source->right);
+			}
+			catch (...) {
+				RestoreSubtree(newNode, source);
+				throw;
+			}
+
+			if (newNode->left != nullptr) newNode->left->parent = newNode;
+			if (newNode->right != nullptr) newNode->right->parent = newNode;
+			return newNode;
+		}
+		// MoveSubtree  (Ϻθ   )    ǵ 
+		void RestoreSubtree(node_base *copied, node_base *source) {
+			if (copied == nullptr)
+				return;
+
+			RestoreSubtree(copied->left, source->left);
+			RestoreSubtree(copied->right, source->right);
+			RestoreValue(copied, source, std::integral_constant<bool, std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value>());
+			DestroyNode(copied);
+		}
+		void RestoreValue(node_base *copied, node_base *source, std::true_type) {
+			T *target = &ValueOf(source);
+			target->~T();
+			new (target) T(std::move(ValueOf(copied)));
+		}
+		void RestoreValue(node_base *, node_base *, std::false_type) {
+		}
+		void SetRoot(node_base *root, int newLength) {
+			header.left = root;
+			rightmost = GetMaxNode(root);
+			if (root != nullptr)
+				root->parent = &header;
+			length = (root != nullptr) ? newLength : 0;
+		}
+
+		// ҷ   (upper)  
+		static int CountUpper(node_base *, node_base *upper, int, std::true_type) {
+			return SizeOf(upper);
+		}
+		// Ʈ ũⰡ    ѵ  辿 ÷     ʸ  
+		static int CountUpper(node_base *lower, node_base *upper, int total, std::false_type) {
+			for (int limit = 1; ; limit *= 2) {
+				int count = CountNodes(upper, limit);
+				if (count <= limit)
+					return count;
+				count = CountNodes(lower, limit);
+				if (count <= limit)
+					return total - count;
+			}
+		}
+		//    limit  ߰ limit + 1 ȯ
+		static int CountNodes(node_base *target, int limit) {
+			if (target == nullptr || limit < 0)
+				return 0;
+
+			int count = CountNodes(target->left, limit - 1) + 1;
+			if (count <= limit)
+				count += CountNodes(target->right, limit - count);
+			return count;
+		}
+
+		static node_base *GetMinNode(node_base *target) {
 			if (target == nullptr)
 				return nullptr;
 
@@ -491,7 +1455,7 @@ namespace bon {
 				target = target->left;
 			return target;
 		}
-		static node *GetMaxNode(node *target) {
+		static node_base *GetMaxNode(node_base *target) {
 			if (target == nullptr)
 				return nullptr;
 
@@ -500,48 +1464,62 @@ namespace bon {
 			return target;
 		}
 
-		static void SwapNode(node *n1, node *n2) {
-			// n1 n2 θ-ڽ , n1 θ ǵ 
-			if (n1->parent == n2) {
-				node *temp = n2;
-				n2 = n1;
-				n1 = temp;
+		static int SizeOf(node_base *target) {
+			return (target != nullptr) ? target->size : 0;
+		}
+		//   ġ ( size), ö󰡸 ã  Բ ȯ
+		static int IndexOf(node_base *target, node_base *&header) {
+			if (target->parent == nullptr) {
+				header = target;
+				return SizeOf(target->left);
 			}
-			bool isLeftChild = n1->left == n2;
-			bool isRightChild = n1->right == n2;
 
-			node *n1_p = n1->parent, *n1_lc = n1->left, *n1_rc = n1->right;
-			node *n2_p = n2->parent, *n2_lc = n2->left, *n2_rc = n2->right;
-
-			if (n2_p != nullptr)
-				((n2 == n2_p->left) ? n2_p->left : n2_p->right) = n1;
-			if (n1_p != nullptr)
-				((n1 == n1_p->left) ? n1_p->left : n1_p->right) = n2;
-
-			n1->parent = (isLeftChild || isRightChild) ? n2 : n2_p;
-			n2->parent = n1_p;
-
-			n1->left = n2_lc;
-			n1->right = n2_rc;
+			int index = SizeOf(target->left);
+			while (target->parent->parent != nullptr) {
+				if (target->parent->right == target)
+					index += SizeOf(target->parent->left) + 1;
+				target = target->parent;
+			}
 
-			n2->left = (isLeftChild) ? n1 : n1_lc;
-			n2->right = (isRightChild) ? n1 : n1_rc;
+			header = target->parent;
+			return index;
+		}
+		static node_base *NodeAt(node_base *header, int index) {
+			node_base *curr = header->left;
+			if (index < 0 || index >= SizeOf(curr))
+				return header;
 
-			if (n2_lc != nullptr) n2_lc->parent = n1;
-			if (n2_rc != nullptr) n2_rc->parent = n1;
+			while (true) {
+				int leftSize = SizeOf(curr->left);
+				if (index < leftSize)
+					curr = curr->left;
+				else if (index == leftSize)
+					return curr;
+				else {
+					index -= leftSize + 1;
+					curr = curr->right;
+				}
+			}
+		}
 
-			if (!isLeftChild && n1_lc != nullptr) n1_lc->parent = n2;
-			if (!isRightChild && n1_rc != nullptr) n1_rc->parent = n2;
+		static T &ValueOf(node_base *target) {
+			return static_cast<node *>(target)->value;
 		}
 
-		bool areEqual(const T &value1, const T &value2) const {
-			return !(compare(value1, value2) ^ compare(value2, value1));
+		static const key_type &KeyOf(const T &value) {
+			return KeyOfValue()(value);
 		}
 
 	protected:
 		const Compare compare;
-		node *root;
+		NodeAllocator nodeAllocator;
+		node_base header;
 		int length;
+		node_base *rightmost; //  ū  (  nullptr)
 		bool bAllowDuplication;
+
+		//    ּ ũ ( , Ʈ )
+		static const int PARALLEL_CUTOFF = 1 << 14;
+		static const int PARALLEL_SIZE = 1 << 10;
 	};
 }
\ No newline at end of file
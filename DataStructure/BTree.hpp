@@ -0,0 +1,798 @@
+#pragma once
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "pool_allocator.hpp"
+#include "tree_traits.hpp"
+
+namespace bon {
+	//  ϳ    ϴ B-Ʈ (ߺ )
+	//   迭 뷫 NodeBytes ũ (⺻ 256Ʈ, ĳ  4)
+	// ĳ  ϳ(64) ̸    ȸ 2 Ѱ  Ž 
+	template <typename T, class Compare = std::less<T>, class Allocator = pool_allocator<T>, class KeyOfValue = identity_key<T>, size_t NodeBytes = 256>
+	class BTree {
+	public:
+		using key_type = typename KeyOfValue::key_type;
+
+	protected:
+		//   迭 뷫 NodeBytes ũⰡ ǵ ִ   
+		static const int MAX_COUNT = (NodeBytes / sizeof(T) > 3) ? static_cast<int>(NodeBytes / sizeof(T)) : 3;
+		static const int MIN_COUNT = (MAX_COUNT - 1) / 2;
+
+		class node {
+		public:
+			node(bool bLeaf) {
+				this->parent = nullptr;
+				this->position = 0;
+				this->count = 0;
+				this->bLeaf = bLeaf;
+			}
+
+			T *slot(int index) {
+				return reinterpret_cast<T *>(&values[index]);
+			}
+
+			node *parent;
+			int position; // θ children ġ
+			int count;
+			bool bLeaf;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type values[MAX_COUNT];
+		};
+		class internal_node : public node {
+		public:
+			internal_node() : node(false) {
+			}
+
+			node *children[MAX_COUNT + 1];
+		};
+
+		using LeafAllocator		= typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+		using LeafTraits		= std::allocator_traits<LeafAllocator>;
+		using InternalAllocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<internal_node>;
+		using InternalTraits	= std::allocator_traits<InternalAllocator>;
+
+	public:
+		class iterator {
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type		= T;
+			using difference_type	= int;
+			using pointer			= T *;
+			using reference			= T &;
+
+			iterator() : curr(nullptr), position(0) {
+			}
+			iterator(node *curr, int position) : curr(curr), position(position) {
+			}
+
+			iterator &operator++() {
+				if (!curr->bLeaf) {
+					curr = GetMinLeaf(ChildOf(curr, position + 1));
+					position = 0;
+					return *this;
+				}
+
+				position++;
+				if (position < curr->count)
+					return *this;
+
+				//  ̸     ö ( end )
+				iterator result = *this;
+				while (result.curr->parent != nullptr && result.position == result.curr->count) {
+					result.position = result.curr->position;
+					result.curr = result.curr->parent;
+				}
+				if (result.position < result.curr->count)
+					*this = result;
+
+				return *this;
+			}
+			const iterator operator++(int) {
+				iterator result(*this);
+				++(*this);
+				return result;
+			}
+			iterator &operator--() {
+				if (!curr->bLeaf) {
+					curr = GetMaxLeaf(ChildOf(curr, position));
+					position = curr->count - 1;
+					return *this;
+				}
+
+				while (position == 0 && curr->parent != nullptr) {
+					position = curr->position;
+					curr = curr->parent;
+				}
+				position--;
+
+				return *this;
+			}
+			const iterator operator--(int) {
+				iterator result(*this);
+				--(*this);
+				return result;
+			}
+
+			bool operator==(const iterator &iter) const {
+				return this->curr == iter.curr && this->position == iter.position;
+			}
+			bool operator!=(const iterator &iter) const {
+				return !(*this == iter);
+			}
+
+			T &operator*() const {
+				return *curr->slot(position);
+			}
+			T *operator->() const {
+				return curr->slot(position);
+			}
+
+		public:
+			node *curr;
+			int position;
+		};
+
+	public:
+		BTree(const Allocator &allocator = Allocator())
+			: compare(Compare()), leafAllocator(allocator), internalAllocator(allocator) {
+			root = leftmost = rightmost = nullptr;
+			length = 0;
+		}
+		BTree(std::initializer_list<T> initList, const Allocator &allocator = Allocator())
+			: BTree(initList.begin(), initList.end(), allocator) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		BTree(const _Iter &first, const _Iter &last, const Allocator &allocator = Allocator())
+			: BTree(allocator) {
+			insert(first, last);
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		BTree(sorted_unique_t, const _Iter &first, const _Iter &last, const Allocator &allocator = Allocator())
+			: BTree(allocator) {
+			for (auto targetIter = first; targetIter != last; targetIter++)
+				AppendBack(*targetIter);
+		}
+		BTree(const BTree &tree) : BTree() {
+			CopyNodes(tree);
+		}
+		BTree(BTree &&tree) noexcept
+			: compare(tree.compare), leafAllocator(std::move(tree.leafAllocator)), internalAllocator(std::move(tree.internalAllocator)) {
+			root = leftmost = rightmost = nullptr;
+			length = 0;
+			TakeNodes(tree);
+		}
+		~BTree() {
+			clear();
+		}
+
+		const BTree &operator=(const BTree &target) {
+			if (this == &target)
+				return *this;
+
+			clear();
+			CopyNodes(target);
+			return *this;
+		}
+		const BTree &operator=(BTree &&target) {
+			if (this == &target)
+				return *this;
+
+			clear();
+			MoveAssign(target, typename LeafTraits::propagate_on_container_move_assignment());
+			return *this;
+		}
+
+		iterator begin() const {
+			return iterator(leftmost, 0);
+		}
+		//   ܸ    ġ end() 
+		iterator end() const {
+			return iterator(rightmost, (rightmost != nullptr) ? rightmost->count : 0);
+		}
+
+		iterator find(const key_type &key) const {
+			return FindKey(key);
+		}
+		iterator lower_bound(const key_type &key) const {
+			return LowerBoundKey(key);
+		}
+		iterator upper_bound(const key_type &key) const {
+			return UpperBoundKey(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator find(const Key &key) const {
+			return FindKey(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator lower_bound(const Key &key) const {
+			return LowerBoundKey(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator upper_bound(const Key &key) const {
+			return UpperBoundKey(key);
+		}
+
+		void insert(const T &value) {
+			InsertValue(value);
+		}
+		void insert(T &&value) {
+			InsertValue(std::move(value));
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		void insert(const _Iter &first, const _Iter &last) {
+			for (auto targetIter = first; targetIter != last; targetIter++)
+				insert(*targetIter);
+		}
+		template <class... Args>
+		void emplace(Args &&...args) {
+			InsertValue(T(std::forward<Args>(args)...));
+		}
+		// hint ٷ  ڸ Ž  ְ ( hint  ū  ), ƴϸ hint ϰ 
+		//   Ǵ ̹ ִ  Ű Ҹ ȯ
+		iterator insert(const iterator &hint, const T &value) {
+			return InsertHint(hint, value);
+		}
+		iterator insert(const iterator &hint, T &&value) {
+			return InsertHint(hint, std::move(value));
+		}
+		template <class... Args>
+		iterator emplace_hint(const iterator &hint, Args &&...args) {
+			return InsertHint(hint, T(std::forward<Args>(args)...));
+		}
+
+		void erase(const key_type &key) {
+			iterator iter = find(key);
+			if (iter != end())
+				erase(iter);
+		}
+		iterator erase(const iterator where) {
+			iterator target = where;
+			node *leaf = target.curr;
+
+			//    ļ ( Ʈ ּڰ) ü  ܸ 忡 
+			if (!leaf->bLeaf) {
+				leaf = GetMinLeaf(ChildOf(target.curr, target.position + 1));
+				T *slot = target.curr->slot(target.position);
+				DestroyValue(slot);
+				new (slot) T(std::move(*leaf->slot(0)));
+				RemoveFromLeaf(leaf, 0);
+			}
+			else
+				RemoveFromLeaf(leaf, target.position);
+			length--;
+
+			// target    Ҹ Ű,  ߿  ̵
+			Rebalance(leaf, target);
+
+			if (root == nullptr)
+				return end();
+			return Normalize(target);
+		}
+		iterator erase(const iterator &first, const iterator &last) {
+			if (first == begin() && last == end()) {
+				clear();
+				return end();
+			}
+
+			//   尡 ġǹǷ last ġ    ݺ
+			int count = 0;
+			for (iterator iter = first; iter != last; ++iter)
+				count++;
+
+			iterator iter = first;
+			while (count-- > 0)
+				iter = erase(iter);
+			return iter;
+		}
+
+		inline int size() const {
+			return length;
+		}
+		inline bool empty() const {
+			return length == 0;
+		}
+		void clear() {
+			ClearNodes(HasRelease<LeafAllocator>());
+			root = leftmost = rightmost = nullptr;
+			length = 0;
+		}
+
+	protected:
+		//  ȿ key ̻ ù ġ (̺ Ž, ܰ踶   )
+		template <class Key>
+		int LowerIndex(node *target, const Key &key) const {
+			int low = 0, high = target->count;
+			while (low < high) {
+				int mid = (low + high) / 2;
+				if (compare(KeyOf(*target->slot(mid)), key))
+					low = mid + 1;
+				else
+					high = mid;
+			}
+			return low;
+		}
+		//  ȿ key ū ù ġ
+		template <class Key>
+		int UpperIndex(node *target, const Key &key) const {
+			int low = 0, high = target->count;
+			while (low < high) {
+				int mid = (low + high) / 2;
+				if (compare(key, KeyOf(*target->slot(mid))))
+					high = mid;
+				else
+					low = mid + 1;
+			}
+			return low;
+		}
+
+		template <class Key>
+		iterator FindKey(const Key &key) const {
+			iterator iter = LowerBoundKey(key);
+			if (iter == end() || compare(key, KeyOf(*iter))) // key < iter->key
+				return end();
+			return iter;
+		}
+		template <class Key>
+		iterator LowerBoundKey(const Key &key) const {
+			iterator result = end();
+
+			for (node *curr = root; curr != nullptr; ) {
+				int index = LowerIndex(curr, key);
+				if (index < curr->count)
+					result = iterator(curr, index);
+				if (curr->bLeaf)
+					break;
+				curr = ChildOf(curr, index);
+			}
+
+			return result;
+		}
+		template <class Key>
+		iterator UpperBoundKey(const Key &key) const {
+			iterator result = end();
+
+			for (node *curr = root; curr != nullptr; ) {
+				int index = UpperIndex(curr, key);
+				if (index < curr->count)
+					result = iterator(curr, index);
+				if (curr->bLeaf)
+					break;
+				curr = ChildOf(curr, index);
+			}
+
+			return result;
+		}
+
+		template <class V>
+		void InsertValue(V &&value) {
+			if (root == nullptr) {
+				root = leftmost = rightmost = CreateLeaf();
+				InsertAt(root, 0, std::forward<V>(value));
+				return;
+			}
+
+			// ܸ    Ű ִ Ȯ
+			node *curr = root;
+			while (true) {
+				int index = LowerIndex(curr, KeyOf(value));
+				if (index < curr->count && !compare(KeyOf(value), KeyOf(*curr->slot(index))))
+					return; // ߺ 
+
+				if (curr->bLeaf) {
+					InsertAt(curr, index, std::forward<V>(value));
+					return;
+				}
+				curr = ChildOf(curr, index);
+			}
+		}
+		// key ڸ   Ž,  Ű   ܸ   ڸ args    (  ҿ false)
+		template <class... Args>
+		std::pair<iterator, bool> EmplaceKey(const key_type &key, Args &&...args) {
+			if (root == nullptr) {
+				root = leftmost = rightmost = CreateLeaf();
+				return std::make_pair(InsertAt(root, 0, std::forward<Args>(args)...), true);
+			}
+
+			node *curr = root;
+			while (true) {
+				int index = LowerIndex(curr, key);
+				if (index < curr->count && !compare(key, KeyOf(*curr->slot(index))))
+					return std::make_pair(iterator(curr, index), false);
+
+				if (curr->bLeaf)
+					return std::make_pair(InsertAt(curr, index, std::forward<Args>(args)...), true);
+				curr = ChildOf(curr, index);
+			}
+		}
+		// hint ܸ   Ű ٷ   < value < hint̸  ڸ ٷ 
+		//  hint   ܸ  ̹Ƿ  ū Һ ũ Ž  ڿ 
+		template <class V>
+		iterator InsertHint(const iterator &hint, V &&value) {
+			node *leaf = hint.curr;
+			int index = hint.position;
+			if (leaf != nullptr && leaf->bLeaf && index > 0 && compare(KeyOf(*leaf->slot(index - 1)), KeyOf(value))) {
+				if (index == leaf->count ? leaf == rightmost : compare(KeyOf(value), KeyOf(*leaf->slot(index))))
+					return InsertAt(leaf, index, std::forward<V>(value));
+			}
+
+			return EmplaceKey(KeyOf(value), std::forward<V>(value)).first;
+		}
+		// ĵ Է Ž    ܸ   ߰
+		template <class V>
+		void AppendBack(V &&value) {
+			if (root == nullptr) {
+				root = leftmost = rightmost = CreateLeaf();
+				InsertAt(root, 0, std::forward<V>(value));
+				return;
+			}
+
+			InsertAt(rightmost, rightmost->count, std::forward<V>(value));
+		}
+		//   ġ ȯ
+		template <class... Args>
+		iterator InsertAt(node *target, int index, Args &&...args) {
+			//    θ   ܰ  Ʈ ״
+			T newValue(std::forward<Args>(args)...);
+
+			if (target->count == MAX_COUNT) {
+				int mid = MAX_COUNT / 2;
+				node *right = Split(target);
+				if (index > mid) {
+					target = right;
+					index -= mid + 1;
+				}
+			}
+
+			ShiftRight(target, index);
+			new (target->slot(index)) T(std::move(newValue));
+			target->count++;
+			length++;
+			return iterator(target, index);
+		}
+
+		//   带 ѷ    θ ø (θ     )
+		node *Split(node *target) {
+			if (target == root) {
+				internal_node *newRoot = CreateInternal();
+				SetChild(newRoot, 0, target);
+				root = newRoot;
+			}
+			else if (target->parent->count == MAX_COUNT)
+				Split(target->parent);
+
+			node *parent = target->parent;
+			int mid = MAX_COUNT / 2;
+
+			node *right = target->bLeaf ? CreateLeaf() : CreateInternal();
+			for (int i = mid + 1; i < target->count; i++)
+				MoveValue(right, i - mid - 1, target, i);
+			if (!target->bLeaf) {
+				for (int i = mid + 1; i <= target->count; i++)
+					SetChild(right, i - mid - 1, ChildOf(target, i));
+			}
+			right->count = target->count - mid - 1;
+
+			//   θ target ٷ ʿ 
+			int position = target->position;
+			ShiftRight(parent, position);
+			for (int i = parent->count; i > position; i--)
+				SetChild(parent, i + 1, ChildOf(parent, i));
+			MoveValue(parent, position, target, mid);
+			SetChild(parent, position + 1, right);
+			parent->count++;
+			target->count = mid;
+
+			if (target == rightmost)
+				rightmost = right;
+
+			return right;
+		}
+
+		void RemoveFromLeaf(node *leaf, int index) {
+			DestroyValue(leaf->slot(index));
+			for (int i = index + 1; i < leaf->count; i++)
+				MoveValue(leaf, i - 1, leaf, i);
+			leaf->count--;
+		}
+
+		// ּ    带 Լ ų ļ  (tracked  Ҹ  Ű )
+		void Rebalance(node *target, iterator &tracked) {
+			while (target != root && target->count < MIN_COUNT) {
+				node *parent = target->parent;
+				int position = target->position;
+
+				if (position > 0 && ChildOf(parent, position - 1)->count > MIN_COUNT) {
+					BorrowFromLeft(target, tracked);
+					return;
+				}
+				if (position < parent->count && ChildOf(parent, position + 1)->count > MIN_COUNT) {
+					BorrowFromRight(target, tracked);
+					return;
+				}
+
+				if (position > 0)
+					Merge(ChildOf(parent, position - 1), tracked);
+				else
+					Merge(target, tracked);
+				target = parent;
+			}
+
+			if (root->count == 0) {
+				node *oldRoot = root;
+				if (root->bLeaf)
+					root = leftmost = rightmost = nullptr;
+				else {
+					root = ChildOf(root, 0);
+					root->parent = nullptr;
+					root->position = 0;
+				}
+				DestroyNode(oldRoot);
+			}
+		}
+		void BorrowFromLeft(node *target, iterator &tracked) {
+			node *parent = target->parent;
+			int position = target->position;
+			node *left = ChildOf(parent, position - 1);
+
+			ShiftRight(target, 0);
+			MoveValue(target, 0, parent, position - 1);
+			MoveValue(parent, position - 1, left, left->count - 1);
+			if (!target->bLeaf) {
+				for (int i = target->count; i >= 0; i--)
+					SetChild(target, i + 1, ChildOf(target, i));
+				SetChild(target, 0, ChildOf(left, left->count));
+			}
+			target->count++;
+			left->count--;
+
+			if (tracked.curr == target)
+				tracked.position++;
+			else if (tracked.curr == parent && tracked.position == position - 1)
+				tracked = iterator(target, 0);
+			else if (tracked.curr == left && tracked.position == left->count)
+				tracked = iterator(parent, position - 1);
+		}
+		void BorrowFromRight(node *target, iterator &tracked) {
+			node *parent = target->parent;
+			int position = target->position;
+			node *right = ChildOf(parent, position + 1);
+
+			MoveValue(target, target->count, parent, position);
+			MoveValue(parent, position, right, 0);
+			for (int i = 1; i < right->count; i++)
+				MoveValue(right, i - 1, right, i);
+			if (!target->bLeaf) {
+				SetChild(target, target->count + 1, ChildOf(right, 0));
+				for (int i = 1; i <= right->count; i++)
+					SetChild(right, i - 1, ChildOf(right, i));
+			}
+			target->count++;
+			right->count--;
+
+			if (tracked.curr == parent && tracked.position == position)
+				tracked = iterator(target, target->count - 1);
+			else if (tracked.curr == right) {
+				if (tracked.position == 0)
+					tracked = iterator(parent, position);
+				else
+					tracked.position--;
+			}
+		}
+		// left    θ   Բ left ϳ ħ
+		void Merge(node *left, iterator &tracked) {
+			node *parent = left->parent;
+			int position = left->position;
+			node *right = ChildOf(parent, position + 1);
+			int leftCount = left->count;
+
+			MoveValue(left, leftCount, parent, position);
+			for (int i = 0; i < right->count; i++)
+				MoveValue(left, leftCount + 1 + i, right, i);
+			if (!left->bLeaf) {
+				for (int i = 0; i <= right->count; i++)
+					SetChild(left, leftCount + 1 + i, ChildOf(right, i));
+			}
+			left->count += right->count + 1;
+
+			for (int i = position + 1; i < parent->count; i++)
+				MoveValue(parent, i - 1, parent, i);
+			for (int i = position + 2; i <= parent->count; i++)
+				SetChild(parent, i - 1, ChildOf(parent, i));
+			parent->count--;
+
+			if (tracked.curr == parent) {
+				if (tracked.position == position)
+					tracked = iterator(left, leftCount);
+				else if (tracked.position > position)
+					tracked.position--;
+			}
+			else if (tracked.curr == right)
+				tracked = iterator(left, leftCount + 1 + tracked.position);
+
+			if (right == rightmost)
+				rightmost = left;
+			right->count = 0;
+			DestroyNode(right);
+		}
+		//   Ű ݺڸ  ( end) ű
+		iterator Normalize(iterator iter) const {
+			if (iter.position < iter.curr->count)
+				return iter;
+
+			while (iter.curr->parent != nullptr && iter.position == iter.curr->count) {
+				iter.position = iter.curr->position;
+				iter.curr = iter.curr->parent;
+			}
+			return (iter.position < iter.curr->count) ? iter : end();
+		}
+
+		void ShiftRight(node *target, int index) {
+			for (int i = target->count; i > index; i--)
+				MoveValue(target, i, target, i - 1);
+		}
+		static void MoveValue(node *dest, int destIndex, node *source, int sourceIndex) {
+			T *sourceSlot = source->slot(sourceIndex);
+			new (dest->slot(destIndex)) T(std::move(*sourceSlot));
+			sourceSlot->~T();
+		}
+		static void DestroyValue(T *target) {
+			target->~T();
+		}
+		static void SetChild(node *parent, int index, node *child) {
+			ChildOf(parent, index) = child;
+			child->parent = parent;
+			child->position = index;
+		}
+		static node *&ChildOf(node *target, int index) {
+			return static_cast<internal_node *>(target)->children[index];
+		}
+		static node *GetMinLeaf(node *target) {
+			while (!target->bLeaf)
+				target = ChildOf(target, 0);
+			return target;
+		}
+		static node *GetMaxLeaf(node *target) {
+			while (!target->bLeaf)
+				target = ChildOf(target, target->count);
+			return target;
+		}
+
+		node *CreateLeaf() {
+			node *newNode = LeafTraits::allocate(leafAllocator, 1);
+			LeafTraits::construct(leafAllocator, newNode, true);
+			return newNode;
+		}
+		internal_node *CreateInternal() {
+			internal_node *newNode = InternalTraits::allocate(internalAllocator, 1);
+			InternalTraits::construct(internalAllocator, newNode);
+			return newNode;
+		}
+		//  ȣϴ ʿ ҸŲ ¿ 
+		void DestroyNode(node *target) {
+			if (target->bLeaf) {
+				LeafTraits::destroy(leafAllocator, target);
+				LeafTraits::deallocate(leafAllocator, target, 1);
+			}
+			else {
+				internal_node *doomed = static_cast<internal_node *>(target);
+				InternalTraits::destroy(internalAllocator, doomed);
+				InternalTraits::deallocate(internalAllocator, doomed, 1);
+			}
+		}
+		void DestroySubtree(node *target) {
+			if (target == nullptr)
+				return;
+
+			if (!target->bLeaf) {
+				for (int i = 0; i <= target->count; i++)
+					DestroySubtree(ChildOf(target, i));
+			}
+			DestroyValues(target, std::is_trivially_destructible<T>());
+			DestroyNode(target);
+		}
+		void DestroyValues(node *target, std::true_type) {
+		}
+		void DestroyValues(node *target, std::false_type) {
+			for (int i = 0; i < target->count; i++)
+				DestroyValue(target->slot(i));
+		}
+		void DestroyAllValues(node *target) {
+			if (!target->bLeaf) {
+				for (int i = 0; i <= target->count; i++)
+					DestroyAllValues(ChildOf(target, i));
+			}
+			DestroyValues(target, std::false_type());
+		}
+
+		void ClearNodes(std::false_type) {
+			DestroySubtree(root);
+		}
+		// Ǯ Ҵڴ  ҸŲ  ûũ   ȯ
+		void ClearNodes(std::true_type) {
+			if (root != nullptr && !std::is_trivially_destructible<T>::value)
+				DestroyAllValues(root);
+			leafAllocator.release();
+			internalAllocator.release();
+		}
+
+		void CopyNodes(const BTree &target) {
+			if (target.root == nullptr)
+				return;
+
+			root = CopySubtree(target.root, nullptr, 0);
+			leftmost = GetMinLeaf(root);
+			rightmost = GetMaxLeaf(root);
+			length = target.length;
+		}
+		node *CopySubtree(node *source, node *parent, int position) {
+			node *newNode = source->bLeaf ? CreateLeaf() : CreateInternal();
+			newNode->parent = parent;
+			newNode->position = position;
+
+			try {
+				for (; newNode->count < source->count; newNode->count++)
+					new (newNode->slot(newNode->count)) T(*source->slot(newNode->count));
+				if (!source->bLeaf) {
+					for (int i = 0; i <= source->count; i++)
+						ChildOf(newNode, i) = nullptr;
+
+					for (int i = 0; i <= source->count; i++)
+						ChildOf(newNode, i) = CopySubtree(ChildOf(source, i), newNode, i);
+				}
+			}
+			catch (...) {
+				if (!newNode->bLeaf) {
+					for (int i = 0; i <= source->count; i++)
+						DestroySubtree(ChildOf(newNode, i));
+				}
+				DestroyValues(newNode, std::is_trivially_destructible<T>());
+				DestroyNode(newNode);
+				throw;
+			}
+
+			return newNode;
+		}
+
+		void TakeNodes(BTree &target) {
+			root = target.root;
+			leftmost = target.leftmost;
+			rightmost = target.rightmost;
+			length = target.length;
+
+			target.root = target.leftmost = target.rightmost = nullptr;
+			target.length = 0;
+		}
+		void MoveAssign(BTree &target, std::true_type) {
+			leafAllocator = std::move(target.leafAllocator);
+			internalAllocator = std::move(target.internalAllocator);
+			TakeNodes(target);
+		}
+		void MoveAssign(BTree &target, std::false_type) {
+			if (leafAllocator == target.leafAllocator && internalAllocator == target.internalAllocator) {
+				TakeNodes(target);
+				return;
+			}
+
+			// Ҵڰ ٸ   ̵
+			for (auto iter = target.begin(); iter != target.end(); ++iter)
+				AppendBack(std::move(*iter));
+			target.clear();
+		}
+
+		static const key_type &KeyOf(const T &value) {
+			return KeyOfValue()(value);
+		}
+
+	protected:
+		const Compare compare;
+		LeafAllocator leafAllocator;
+		InternalAllocator internalAllocator;
+		node *root;
+		node *leftmost, *rightmost;
+		int length;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,937 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "AVLTree.hpp"
+
+namespace bon {
+	// set/map Allocator ڸ  带  迭  ΰ 32Ʈ ε ϴ    
+	// Ҹ ٴ     int (32Ʈ)  ε   1Ʈ (13Ʈ)
+	// 迭 Ŀ  Ҹ űǷ   ʹ   ȿ   
+	// ݺڴ Ʈ ü ε Ҹ ŰǷ ԰ ٸ   Ŀ ,
+	// std::set ޸ Ʈ ̵, ȯ, , ġ ڿ ȿ (Ű  Ʈ ٽ ؾ )
+	// AVL  ϸ ,  ,     (Ұ ġ Ҹ Űܼ )
+	struct compact_storage {
+	};
+
+	template <typename T, class Compare, class KeyOfValue, class Augment, class Balance>
+	class AVLTree<T, Compare, compact_storage, KeyOfValue, Augment, Balance> {
+		static_assert(std::is_same<Augment, no_augment>::value, "compact_storage does not support augmentation");
+		static_assert(std::is_same<Balance, avl_balance>::value, "compact_storage supports only avl_balance");
+
+	public:
+		using key_type = typename KeyOfValue::key_type;
+		using index_type = uint32_t;
+
+	protected:
+		// 0   , ε 0 ڽ  (Ʈ θ ڸ̸ , ݺ̸ end)
+		struct slot {
+			index_type parent;
+			index_type left, right;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type value;
+		};
+
+		static const index_type NIL = 0;
+		static const size_t INITIAL_SLOTS = 16;
+		static const size_t MAX_SLOTS = 0xFFFFFFFFu;
+
+	public:
+		class iterator {
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type		= T;
+			using difference_type	= int;
+			using pointer			= T *;
+			using reference			= T &;
+
+			iterator() : owner(nullptr), curr(NIL) {
+			}
+			iterator(const AVLTree *owner, index_type curr) : owner(owner), curr(curr) {
+			}
+
+			iterator &operator++() {
+				curr = owner->NextIndex(curr);
+				return *this;
+			}
+			const iterator operator++(int) {
+				iterator result(*this);
+				++(*this);
+				return result;
+			}
+			iterator &operator--() {
+				curr = owner->PrevIndex(curr);
+				return *this;
+			}
+			const iterator operator--(int) {
+				iterator result(*this);
+				--(*this);
+				return result;
+			}
+
+			bool operator==(const iterator &iter) const {
+				return this->curr == iter.curr;
+			}
+			bool operator!=(const iterator &iter) const {
+				return !(*this == iter);
+			}
+
+			T &operator*() const {
+				return owner->ValueOf(curr);
+			}
+			T *operator->() const {
+				return &owner->ValueOf(curr);
+			}
+
+		public:
+			const AVLTree *owner;
+			index_type curr;
+		};
+
+	public:
+		AVLTree(bool bAllowDuplication = true, const compact_storage & = compact_storage())
+			: compare(Compare()), bAllowDuplication(bAllowDuplication) {
+			slots = nullptr;
+			heights = nullptr;
+			slotCapacity = 0;
+			used = 0;
+			freeList = NIL;
+			root = NIL;
+			length = 0;
+		}
+		AVLTree(std::initializer_list<T> initList, bool bAllowDuplication = true, const compact_storage &storage = compact_storage())
+			: AVLTree(initList.begin(), initList.end(), bAllowDuplication, storage) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		AVLTree(const _Iter &first, const _Iter &last, bool bAllowDuplication = true, const compact_storage &storage = compact_storage())
+			: AVLTree(bAllowDuplication, storage) {
+			insert(first, last);
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		AVLTree(sorted_unique_t, const _Iter &first, const _Iter &last, bool bAllowDuplication = true, const compact_storage &storage = compact_storage())
+			: AVLTree(bAllowDuplication, storage) {
+			InsertSortedRange(first, last, typename std::iterator_traits<_Iter>::iterator_category());
+		}
+		AVLTree(const AVLTree &tree) : AVLTree(tree.bAllowDuplication) {
+			CopySlots(tree);
+		}
+		AVLTree(AVLTree &&tree) noexcept : AVLTree(tree.bAllowDuplication) {
+			TakeSlots(tree);
+		}
+		~AVLTree() {
+			clear();
+		}
+
+		const AVLTree &operator=(const AVLTree &target) {
+			if (this == &target)
+				return *this;
+
+			clear();
+			bAllowDuplication = target.bAllowDuplication;
+			CopySlots(target);
+			return *this;
+		}
+		const AVLTree &operator=(AVLTree &&target) {
+			if (this == &target)
+				return *this;
+
+			clear();
+			bAllowDuplication = target.bAllowDuplication;
+			TakeSlots(target);
+			return *this;
+		}
+
+		iterator begin() const {
+			return iterator(this, (root != NIL) ? GetMinIndex(root) : NIL);
+		}
+		iterator end() const {
+			return iterator(this, NIL);
+		}
+
+		iterator find(const key_type &key) const {
+			return iterator(this, FindIndex(key));
+		}
+		iterator lower_bound(const key_type &key) const {
+			return iterator(this, LowerBoundIndex(key));
+		}
+		iterator upper_bound(const key_type &key) const {
+			return iterator(this, UpperBoundIndex(key));
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator find(const Key &key) const {
+			return iterator(this, FindIndex(key));
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator lower_bound(const Key &key) const {
+			return iterator(this, LowerBoundIndex(key));
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator upper_bound(const Key &key) const {
+			return iterator(this, UpperBoundIndex(key));
+		}
+
+		void insert(const T &value) {
+			InsertValue(value);
+		}
+		void insert(T &&value) {
+			InsertValue(std::move(value));
+		}
+		// hint ٷ տ  (hint   Ʈ Ž), Ե ҳ ̹ ִ  Ҹ ȯ
+		iterator insert(const iterator &hint, const T &value) {
+			return InsertValue(hint.curr, value);
+		}
+		iterator insert(const iterator &hint, T &&value) {
+			return InsertValue(hint.curr, std::move(value));
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		void insert(const _Iter &first, const _Iter &last) {
+			if (empty()) {
+				InsertRange(first, last, typename std::iterator_traits<_Iter>::iterator_category());
+				return;
+			}
+
+			InsertEach(first, last);
+		}
+		// ġ ã  Ű ־ ϹǷ     Ű 
+		template <class... Args>
+		void emplace(Args &&...args) {
+			InsertValue(T(std::forward<Args>(args)...));
+		}
+		template <class... Args>
+		iterator emplace_hint(const iterator &hint, Args &&...args) {
+			return InsertValue(hint.curr, T(std::forward<Args>(args)...));
+		}
+
+		void erase(const key_type &key) {
+			if (!bAllowDuplication) {
+				index_type target = FindIndex(key);
+				if (target != NIL)
+					EraseNode(target);
+				return;
+			}
+
+			iterator iter = lower_bound(key);
+			iterator last = upper_bound(key);
+
+			while (iter != last)
+				iter = erase(iter);
+		}
+		// ļ   ƴ϶ ° ŰǷ   ε ״
+		iterator erase(const iterator where) {
+			iterator nextIter = where;
+			++nextIter;
+			EraseNode(where.curr);
+			return nextIter;
+		}
+		iterator erase(const iterator &first, const iterator &last) {
+			iterator iter;
+			for (iter = first; iter != last; )
+				iter = erase(iter);
+			return iter;
+		}
+
+		inline int size() const {
+			return length;
+		}
+		inline bool empty() const {
+			return root == NIL;
+		}
+		void clear() {
+			DestroyValues(std::is_trivially_destructible<T>());
+			::operator delete(slots);
+			::operator delete(heights);
+
+			slots = nullptr;
+			heights = nullptr;
+			slotCapacity = 0;
+			used = 0;
+			freeList = NIL;
+			root = NIL;
+			length = 0;
+		}
+		//  count  ű ʰ   ֵ 迭 Ű
+		void reserve(int count) {
+			if (static_cast<size_t>(count) + 1 > slotCapacity)
+				Reallocate(static_cast<size_t>(count) + 1);
+		}
+		//  迭 ϴ Ʈ 
+		size_t memory_usage() const {
+			return slotCapacity * (sizeof(slot) + sizeof(uint8_t));
+		}
+
+		// key ̻ Ҹ right ű,  Ʈ key ̸ Ҹ  (right  Ҵ )
+		void split(const key_type &key, AVLTree &right) {
+			if (this == &right)
+				return;
+
+			right.clear();
+
+			iterator lower = lower_bound(key);
+			if (lower == end())
+				return;
+
+			int upperCount = static_cast<int>(std::distance(lower, end()));
+			right.BuildSorted(std::make_move_iterator(lower), std::make_move_iterator(end()), upperCount, false);
+
+			//      װ, ƴϸ ű Ҹ 
+			if (length - upperCount < upperCount) {
+				AVLTree left(bAllowDuplication);
+				left.BuildSorted(std::make_move_iterator(begin()), std::make_move_iterator(lower), length - upperCount, false);
+				clear();
+				TakeSlots(left);
+			}
+			else
+				erase(lower, end());
+		}
+		// right Ҹ  ڿ ̾  (right  Ű  Ʈ Ű Ŀ ), right 
+		//   Ҹ ū   ϳ Ű 
+		void join(AVLTree &&right) {
+			if (this == &right || right.empty())
+				return;
+
+			if (!empty()) {
+				const key_type &lastKey = KeyOf(ValueOf(GetMaxIndex(root)));
+				const key_type &firstKey = KeyOf(right.ValueOf(right.GetMinIndex(right.root)));
+				if (bAllowDuplication ? compare(firstKey, lastKey) : !compare(lastKey, firstKey))
+					throw new std::runtime_error("join() called with overlapping keys");
+			}
+
+			if (length < right.length) {
+				index_type hint = right.GetMinIndex(right.root);
+				for (index_type curr = (root != NIL) ? GetMaxIndex(root) : NIL; curr != NIL; curr = PrevIndex(curr))
+					hint = right.InsertValue(hint, std::move(ValueOf(curr))).curr;
+
+				clear();
+				TakeSlots(right);
+				return;
+			}
+
+			for (index_type curr = right.GetMinIndex(right.root); curr != NIL; curr = right.NextIndex(curr))
+				InsertValue(NIL, std::move(right.ValueOf(curr)));
+			right.clear();
+		}
+
+	protected:
+		template <class Key>
+		index_type FindIndex(const Key &key) const {
+			index_type result = LowerBoundIndex(key);
+			if (result == NIL || compare(key, KeyOf(ValueOf(result)))) // key < result->key
+				return NIL;
+			return result;
+		}
+		template <class Key>
+		index_type LowerBoundIndex(const Key &key) const {
+			index_type result = NIL;
+			index_type curr = root;
+
+			while (curr != NIL) {
+				if (!compare(KeyOf(ValueOf(curr)), key)) { // key <= curr->key
+					result = curr;
+					curr = slots[curr].left;
+				}
+				else
+					curr = slots[curr].right;
+			}
+
+			return result;
+		}
+		template <class Key>
+		index_type UpperBoundIndex(const Key &key) const {
+			index_type result = NIL;
+			index_type curr = root;
+
+			while (curr != NIL) {
+				if (compare(key, KeyOf(ValueOf(curr)))) { // key < curr->key
+					result = curr;
+					curr = slots[curr].left;
+				}
+				else
+					curr = slots[curr].right;
+			}
+
+			return result;
+		}
+
+		template <class V>
+		void InsertValue(V &&value) {
+			index_type parent, equal;
+			bool bLeft;
+			if (!FindInsertPosition(KeyOf(value), parent, bLeft, equal))
+				return;
+
+			AttachNode(CreateNode(std::forward<V>(value)), parent, bLeft);
+		}
+		template <class V>
+		iterator InsertValue(index_type hint, V &&value) {
+			index_type parent, equal;
+			bool bLeft;
+			if (!FindHintPosition(hint, KeyOf(value), parent, bLeft, equal))
+				FindInsertPosition(KeyOf(value), parent, bLeft, equal);
+			if (equal != NIL)
+				return iterator(this, equal);
+
+			index_type newIndex = CreateNode(std::forward<V>(value));
+			AttachNode(newIndex, parent, bLeft);
+			return iterator(this, newIndex);
+		}
+		// AVLTree::EmplaceKey 
+		template <class... Args>
+		std::pair<iterator, bool> EmplaceKey(const key_type &key, Args &&...args) {
+			index_type parent, equal;
+			bool bLeft;
+			if (!FindInsertPosition(key, parent, bLeft, equal))
+				return std::make_pair(iterator(this, equal), false);
+
+			index_type newIndex = CreateNode(std::forward<Args>(args)...);
+			AttachNode(newIndex, parent, bLeft);
+			return std::make_pair(iterator(this, newIndex), true);
+		}
+		template <class _Iter>
+		void InsertEach(const _Iter &first, const _Iter &last) {
+			iterator hint = end();
+			for (auto targetIter = first; targetIter != last; targetIter++) {
+				hint = InsertValue(hint.curr, *targetIter);
+				++hint;
+			}
+		}
+		// AVLTree::FindHintPosition  (hint NIL̸ )
+		bool FindHintPosition(index_type hint, const key_type &key, index_type &parent, bool &bLeft, index_type &equal) const {
+			equal = NIL;
+			if (root == NIL)
+				return false;
+
+			index_type prev;
+			if (hint == NIL)
+				prev = GetMaxIndex(root);
+			else {
+				if (compare(KeyOf(ValueOf(hint)), key))
+					return false;
+				if (!bAllowDuplication && !compare(key, KeyOf(ValueOf(hint)))) {
+					equal = hint;
+					return true;
+				}
+
+				// hint    NIL
+				prev = PrevIndex(hint);
+			}
+
+			if (prev != NIL) {
+				if (compare(key, KeyOf(ValueOf(prev))))
+					return false;
+				if (!bAllowDuplication && !compare(KeyOf(ValueOf(prev)), key)) {
+					equal = prev;
+					return true;
+				}
+			}
+
+			if (prev != NIL && slots[prev].right == NIL) {
+				parent = prev;
+				bLeft = false;
+			}
+			else {
+				parent = hint;
+				bLeft = true;
+			}
+			return true;
+		}
+		bool FindInsertPosition(const key_type &key, index_type &parent, bool &bLeft, index_type &equal) const {
+			parent = NIL;
+			bLeft = true;
+			equal = NIL;
+
+			index_type notGreater = NIL;
+
+			index_type next = root;
+			while (next != NIL) {
+				parent = next;
+				bLeft = compare(key, KeyOf(ValueOf(parent)));
+				if (bLeft)
+					next = slots[parent].left;
+				else {
+					notGreater = parent;
+					next = slots[parent].right;
+				}
+			}
+
+			if (!bAllowDuplication && notGreater != NIL && !compare(KeyOf(ValueOf(notGreater)), key)) {
+				equal = notGreater;
+				return false;
+			}
+
+			return true;
+		}
+		void AttachNode(index_type newIndex, index_type parent, bool bLeft) {
+			slots[newIndex].parent = parent;
+			slots[newIndex].left = NIL;
+			slots[newIndex].right = NIL;
+			if (parent == NIL)
+				root = newIndex;
+			else if (bLeft)
+				slots[parent].left = newIndex;
+			else
+				slots[parent].right = newIndex;
+			length++;
+
+			RetraceAfterInsert(newIndex);
+		}
+		void EraseNode(index_type target) {
+			index_type retraceFrom = UnlinkNode(target);
+			DestroyNode(target);
+			length--;
+
+			RetraceAfterErase(retraceFrom);
+		}
+		// AVLTree::UnlinkNode  (ڽ ̸ ļ 带   Ű  ڸ ä)
+		index_type UnlinkNode(index_type target) {
+			index_type parent = slots[target].parent;
+			index_type left = slots[target].left;
+			index_type right = slots[target].right;
+
+			if (left == NIL || right == NIL) {
+				ReplaceChild(parent, target, (left != NIL) ? left : right);
+				return parent;
+			}
+
+			index_type successor = GetMinIndex(right);
+			index_type retraceFrom = successor;
+			if (successor != right) {
+				retraceFrom = slots[successor].parent;
+				index_type successorRight = slots[successor].right;
+				slots[retraceFrom].left = successorRight;
+				if (successorRight != NIL)
+					slots[successorRight].parent = retraceFrom;
+
+				slots[successor].right = right;
+				slots[right].parent = successor;
+			}
+
+			slots[successor].left = left;
+			slots[left].parent = successor;
+			heights[successor] = heights[target];
+			ReplaceChild(parent, target, successor);
+
+			return retraceFrom;
+		}
+		// parent ڽ oldChild ڸ newChild ٲ (parent NIL̸ Ʈ)
+		void ReplaceChild(index_type parent, index_type oldChild, index_type newChild) {
+			if (parent == NIL)
+				root = newChild;
+			else if (slots[parent].left == oldChild)
+				slots[parent].left = newChild;
+			else
+				slots[parent].right = newChild;
+
+			if (newChild != NIL)
+				slots[newChild].parent = parent;
+		}
+
+		// avl_balance  : ̰ ״ 忡 
+		void RetraceAfterInsert(index_type target) {
+			for (target = slots[target].parent; target != NIL; target = slots[target].parent) {
+				int oldHeight = heights[target];
+				RecalcHeight(target);
+
+				if (abs(BalanceOf(target)) >= 2) {
+					MaintainBalance(target);
+					return;
+				}
+				if (heights[target] == oldHeight)
+					return;
+			}
+		}
+		void RetraceAfterErase(index_type target) {
+			while (target != NIL) {
+				int oldHeight = heights[target];
+				RecalcHeight(target);
+
+				if (abs(BalanceOf(target)) >= 2)
+					target = MaintainBalance(target);
+				if (heights[target] == oldHeight)
+					return;
+
+				target = slots[target].parent;
+			}
+		}
+		//   2 带  Ǵ  ȸ ϰ  κ Ʈ Ʈ ȯ
+		index_type MaintainBalance(index_type target) {
+			if (BalanceOf(target) < 0) {
+				index_type child = slots[target].left;
+				if (BalanceOf(child) > 0) {
+					index_type grandChild = slots[child].right;
+					Rotate(grandChild);
+					Rotate(grandChild);
+					return grandChild;
+				}
+
+				Rotate(child);
+				return child;
+			}
+
+			index_type child = slots[target].right;
+			if (BalanceOf(child) < 0) {
+				index_type grandChild = slots[child].left;
+				Rotate(grandChild);
+				Rotate(grandChild);
+				return grandChild;
+			}
+
+			Rotate(child);
+			return child;
+		}
+		// target θ ڸ ø  ȸ
+		void Rotate(index_type target) {
+			index_type parent = slots[target].parent;
+			index_type grand = slots[parent].parent;
+
+			if (slots[parent].left == target) {
+				index_type middle = slots[target].right;
+				slots[parent].left = middle;
+				if (middle != NIL)
+					slots[middle].parent = parent;
+				slots[target].right = parent;
+			}
+			else {
+				index_type middle = slots[target].left;
+				slots[parent].right = middle;
+				if (middle != NIL)
+					slots[middle].parent = parent;
+				slots[target].left = parent;
+			}
+
+			slots[parent].parent = target;
+			ReplaceChild(grand, parent, target);
+
+			RecalcHeight(parent);
+			RecalcHeight(target);
+		}
+		int BalanceOf(index_type target) const {
+			return heights[slots[target].right] - heights[slots[target].left];
+		}
+		// heights[NIL] 0̹Ƿ  ڽĵ ״ 
+		void RecalcHeight(index_type target) {
+			uint8_t leftHeight = heights[slots[target].left];
+			uint8_t rightHeight = heights[slots[target].right];
+
+			heights[target] = static_cast<uint8_t>(((leftHeight > rightHeight) ? leftHeight : rightHeight) + 1);
+		}
+
+		index_type NextIndex(index_type curr) const {
+			if (slots[curr].right != NIL)
+				return GetMinIndex(slots[curr].right);
+
+			index_type parent = slots[curr].parent;
+			while (parent != NIL && slots[parent].right == curr) {
+				curr = parent;
+				parent = slots[curr].parent;
+			}
+			return parent;
+		}
+		// end(NIL)   ū 
+		index_type PrevIndex(index_type curr) const {
+			if (curr == NIL)
+				return (root != NIL) ? GetMaxIndex(root) : NIL;
+			if (slots[curr].left != NIL)
+				return GetMaxIndex(slots[curr].left);
+
+			index_type parent = slots[curr].parent;
+			while (parent != NIL && slots[parent].left == curr) {
+				curr = parent;
+				parent = slots[curr].parent;
+			}
+			return parent;
+		}
+		index_type GetMinIndex(index_type target) const {
+			while (slots[target].left != NIL)
+				target = slots[target].left;
+			return target;
+		}
+		index_type GetMaxIndex(index_type target) const {
+			while (slots[target].right != NIL)
+				target = slots[target].right;
+			return target;
+		}
+
+		//  (  켱)   ̸ 1 ǥ
+		template <class... Args>
+		index_type CreateNode(Args &&...args) {
+			if (freeList == NIL && used == slotCapacity) {
+				// args 迭  Ҹ ų  Ƿ 迭 ű    
+				T value(std::forward<Args>(args)...);
+				Reallocate(NextCapacity());
+				return ConstructAt(TakeSlot(), std::move(value));
+			}
+
+			return ConstructAt(TakeSlot(), std::forward<Args>(args)...);
+		}
+		template <class... Args>
+		index_type ConstructAt(index_type target, Args &&...args) {
+			try {
+				new (&slots[target].value) T(std::forward<Args>(args)...);
+			}
+			catch (...) {
+				ReleaseSlot(target);
+				throw;
+			}
+			heights[target] = 1;
+			return target;
+		}
+		void DestroyNode(index_type target) {
+			ValueOf(target).~T();
+			ReleaseSlot(target);
+		}
+		index_type TakeSlot() {
+			if (freeList != NIL) {
+				index_type target = freeList;
+				freeList = slots[target].left;
+				return target;
+			}
+			return static_cast<index_type>(used++);
+		}
+		void ReleaseSlot(index_type target) {
+			heights[target] = 0;
+			slots[target].left = freeList;
+			freeList = target;
+		}
+
+		size_t NextCapacity() const {
+			if (slotCapacity >= MAX_SLOTS)
+				throw new std::length_error("compact_storage cannot index more elements");
+
+			// 1.5辿 ÷   Ҵ  ũ  Ϸ 
+			size_t newCapacity = (slotCapacity == 0) ? INITIAL_SLOTS : slotCapacity + slotCapacity / 2;
+			if (newCapacity > MAX_SLOTS)
+				newCapacity = MAX_SLOTS;
+			return newCapacity;
+		}
+		//  ū 迭 ű (ε ״)
+		void Reallocate(size_t newCapacity) {
+			slot *newSlots = static_cast<slot *>(::operator new(newCapacity * sizeof(slot)));
+			uint8_t *newHeights;
+			try {
+				newHeights = static_cast<uint8_t *>(::operator new(newCapacity * sizeof(uint8_t)));
+			}
+			catch (...) {
+				::operator delete(newSlots);
+				throw;
+			}
+
+			if (used == 0) {
+				// 0   ڽ  ( 0, ᵵ 0)
+				newSlots[NIL].parent = newSlots[NIL].left = newSlots[NIL].right = NIL;
+				newHeights[NIL] = 0;
+				used = 1;
+			}
+			else {
+				try {
+					TransferSlots(newSlots, *this, [](T &value) -> decltype(auto) { return std::move_if_noexcept(value); }, std::is_trivially_copyable<T>());
+				}
+				catch (...) {
+					::operator delete(newSlots);
+					::operator delete(newHeights);
+					throw;
+				}
+				std::memcpy(newHeights, heights, used);
+
+				DestroyValues(std::is_trivially_destructible<T>());
+				::operator delete(slots);
+				::operator delete(heights);
+			}
+
+			slots = newSlots;
+			heights = newHeights;
+			slotCapacity = newCapacity;
+		}
+		// source   ε target űų  (  Ḹ )
+		template <class Transfer>
+		static void TransferSlots(slot *target, const AVLTree &source, Transfer, std::true_type) {
+			std::memcpy(target, source.slots, source.used * sizeof(slot));
+		}
+		template <class Transfer>
+		static void TransferSlots(slot *target, const AVLTree &source, Transfer transfer, std::false_type) {
+			size_t i = 0;
+			try {
+				for (; i < source.used; i++) {
+					target[i].parent = source.slots[i].parent;
+					target[i].left = source.slots[i].left;
+					target[i].right = source.slots[i].right;
+					if (source.heights[i] != 0)
+						new (&target[i].value) T(transfer(source.ValueOf(static_cast<index_type>(i))));
+				}
+			}
+			catch (...) {
+				for (size_t j = 0; j < i; j++) {
+					if (source.heights[j] != 0)
+						reinterpret_cast<T *>(&target[j].value)->~T();
+				}
+				throw;
+			}
+		}
+		// 迭 ״  ( ԰  ϵ )
+		void CopySlots(const AVLTree &source) {
+			if (source.used == 0)
+				return;
+
+			slot *newSlots = static_cast<slot *>(::operator new(source.used * sizeof(slot)));
+			uint8_t *newHeights;
+			try {
+				newHeights = static_cast<uint8_t *>(::operator new(source.used * sizeof(uint8_t)));
+				try {
+					TransferSlots(newSlots, source, [](const T &value) -> const T & { return value; }, std::is_trivially_copyable<T>());
+				}
+				catch (...) {
+					::operator delete(newHeights);
+					throw;
+				}
+			}
+			catch (...) {
+				::operator delete(newSlots);
+				throw;
+			}
+			std::memcpy(newHeights, source.heights, source.used);
+
+			slots = newSlots;
+			heights = newHeights;
+			slotCapacity = source.used;
+			used = source.used;
+			freeList = source.freeList;
+			root = source.root;
+			length = source.length;
+		}
+		// 迭 ° Ѱܹ ( Ʈ  ־ )
+		void TakeSlots(AVLTree &target) {
+			std::swap(slots, target.slots);
+			std::swap(heights, target.heights);
+			std::swap(slotCapacity, target.slotCapacity);
+			std::swap(used, target.used);
+			std::swap(freeList, target.freeList);
+			std::swap(root, target.root);
+			std::swap(length, target.length);
+		}
+		void DestroyValues(std::true_type) {
+		}
+		void DestroyValues(std::false_type) {
+			for (size_t i = 1; i < used; i++) {
+				if (heights[i] != 0)
+					ValueOf(static_cast<index_type>(i)).~T();
+			}
+		}
+
+		//  Ʈ   , ĵ Է̸ O(n) 
+		template <class _Iter>
+		void InsertRange(const _Iter &first, const _Iter &last, std::input_iterator_tag) {
+			InsertEach(first, last);
+		}
+		template <class _Iter>
+		void InsertRange(const _Iter &first, const _Iter &last, std::forward_iterator_tag) {
+			int count = 0;
+			bool bSkipEqual = false;
+
+			if (!CountSortedRange(first, last, count, bSkipEqual)) {
+				InsertEach(first, last);
+				return;
+			}
+
+			BuildSorted(first, last, count, bSkipEqual);
+		}
+		template <class _Iter>
+		void InsertSortedRange(const _Iter &first, const _Iter &last, std::input_iterator_tag) {
+			InsertEach(first, last);
+		}
+		template <class _Iter>
+		void InsertSortedRange(const _Iter &first, const _Iter &last, std::forward_iterator_tag) {
+			BuildSorted(first, last, static_cast<int>(std::distance(first, last)), false);
+		}
+		template <class _Iter>
+		bool CountSortedRange(_Iter first, const _Iter &last, int &count, bool &bSkipEqual) const {
+			count = 0;
+			bSkipEqual = false;
+			if (first == last)
+				return true;
+
+			_Iter prev = first;
+			count = 1;
+			for (++first; first != last; prev = first, ++first) {
+				if (compare(KeyOf(*first), KeyOf(*prev)))
+					return false;
+
+				if (bAllowDuplication || compare(KeyOf(*prev), KeyOf(*first)))
+					count++;
+				else
+					bSkipEqual = true;
+			}
+
+			return true;
+		}
+
+		//  Ʈ ĵ Է   Ʈ  (   ġǾ ȸ 迭 ʷ )
+		template <class _Iter>
+		void BuildSorted(_Iter first, const _Iter &last, int count, bool bSkipEqual) {
+			if (count == 0)
+				return;
+
+			reserve(count);
+			try {
+				root = BuildSortedSubtree(first, last, count, bSkipEqual);
+			}
+			catch (...) {
+				clear();
+				throw;
+			}
+			slots[root].parent = NIL;
+			length = count;
+		}
+		template <class _Iter>
+		index_type BuildSortedSubtree(_Iter &iter, const _Iter &last, int count, bool bSkipEqual) {
+			if (count == 0)
+				return NIL;
+
+			int leftCount = count / 2;
+			index_type left = BuildSortedSubtree(iter, last, leftCount, bSkipEqual);
+			index_type curr = CreateNode(*iter);
+
+			_Iter prev = iter;
+			++iter;
+			if (bSkipEqual) {
+				while (iter != last && !compare(KeyOf(*prev), KeyOf(*iter)))
+					++iter;
+			}
+
+			index_type right = BuildSortedSubtree(iter, last, count - leftCount - 1, bSkipEqual);
+
+			slots[curr].left = left;
+			slots[curr].right = right;
+			if (left != NIL)
+				slots[left].parent = curr;
+			if (right != NIL)
+				slots[right].parent = curr;
+			RecalcHeight(curr);
+			return curr;
+		}
+
+		T &ValueOf(index_type target) const {
+			return *reinterpret_cast<T *>(&slots[target].value);
+		}
+
+		static const key_type &KeyOf(const T &value) {
+			return KeyOfValue()(value);
+		}
+
+	protected:
+		Compare compare;
+		slot *slots;
+		uint8_t *heights; // heights[NIL] 0,  Ե 0
+		size_t slotCapacity;
+		size_t used; //  ̶    (0 )
+		index_type freeList; //    (left )
+		index_type root;
+		int length;
+		bool bAllowDuplication;
+	};
+}
\ No newline at end of file
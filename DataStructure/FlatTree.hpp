@@ -0,0 +1,253 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "tree_traits.hpp"
+#include "vector.hpp"
+
+namespace bon {
+	// ĵ  迭  ϴ  ̳ (ߺ )
+	//      ȸϴ Ϳ:  Ͱ  ̺ Ž ĳÿ  
+	//  ϳ ְų   Ҹ  űǷ O(n),   insert(first, last)    
+	// Container   ݺڿ push_back, pop_back, reserve, size, clear ؾ 
+	template <typename T, class Compare = std::less<T>, class KeyOfValue = identity_key<T>, class Container = vector<T>>
+	class FlatTree {
+	public:
+		using key_type = typename KeyOfValue::key_type;
+		using container_type = Container;
+
+		using iterator = typename Container::iterator;
+		using const_iterator = typename Container::const_iterator;
+
+	public:
+		FlatTree() : compare(Compare()) {
+		}
+		FlatTree(std::initializer_list<T> initList) : FlatTree(initList.begin(), initList.end()) {
+		}
+		// Ƽ    ( Ű ó  Ҹ )
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		FlatTree(const _Iter &first, const _Iter &last) : FlatTree() {
+			insert(first, last);
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		FlatTree(sorted_unique_t, const _Iter &first, const _Iter &last) : FlatTree() {
+			AppendSorted(first, last);
+		}
+
+		iterator begin() {
+			return container.begin();
+		}
+		iterator end() {
+			return container.end();
+		}
+		const_iterator begin() const {
+			return container.begin();
+		}
+		const_iterator end() const {
+			return container.end();
+		}
+
+		iterator find(const key_type &key) {
+			return begin() + FindIndex(key);
+		}
+		iterator lower_bound(const key_type &key) {
+			return begin() + LowerIndex(key);
+		}
+		iterator upper_bound(const key_type &key) {
+			return begin() + UpperIndex(key);
+		}
+		const_iterator find(const key_type &key) const {
+			return begin() + FindIndex(key);
+		}
+		const_iterator lower_bound(const key_type &key) const {
+			return begin() + LowerIndex(key);
+		}
+		const_iterator upper_bound(const key_type &key) const {
+			return begin() + UpperIndex(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator find(const Key &key) {
+			return begin() + FindIndex(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator lower_bound(const Key &key) {
+			return begin() + LowerIndex(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator upper_bound(const Key &key) {
+			return begin() + UpperIndex(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		const_iterator find(const Key &key) const {
+			return begin() + FindIndex(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		const_iterator lower_bound(const Key &key) const {
+			return begin() + LowerIndex(key);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		const_iterator upper_bound(const Key &key) const {
+			return begin() + UpperIndex(key);
+		}
+
+		void insert(const T &value) {
+			InsertValue(value);
+		}
+		void insert(T &&value) {
+			InsertValue(std::move(value));
+		}
+		// ڿ     κи   迭  (Ҹ ű )
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		void insert(const _Iter &first, const _Iter &last) {
+			int oldLength = size();
+			//  Ҹ ̰ų ϴ ߿ ܰ   κи   迭 ״
+			try {
+				for (auto targetIter = first; targetIter != last; targetIter++)
+					container.push_back(*targetIter);
+				std::stable_sort(begin() + oldLength, end(), ValueCompare(compare));
+			}
+			catch (...) {
+				PopBack(size() - oldLength);
+				throw;
+			}
+
+			iterator middle = begin() + oldLength;
+			if (oldLength > 0 && middle != end() && compare(KeyOf(*middle), KeyOf(*(middle - 1))))
+				std::inplace_merge(begin(), middle, end(), ValueCompare(compare));
+
+			//  ̶  Ű   (Ǵ   ) տ 
+			iterator newEnd = std::unique(begin(), end(), [this](const T &left, const T &right) {
+				return !compare(KeyOf(left), KeyOf(right));
+			});
+			PopBack(static_cast<int>(end() - newEnd));
+		}
+		template <class... Args>
+		void emplace(Args &&...args) {
+			InsertValue(T(std::forward<Args>(args)...));
+		}
+		template <class... Args>
+		void emplace_hint(const const_iterator &hint, Args &&...args) {
+			emplace(std::forward<Args>(args)...);
+		}
+
+		void erase(const key_type &key) {
+			iterator iter = find(key);
+			if (iter != end())
+				erase(iter);
+		}
+		iterator erase(const const_iterator where) {
+			return erase(where, where + 1);
+		}
+		iterator erase(const const_iterator &first, const const_iterator &last) {
+			iterator target = begin() + (first - begin());
+			std::move(begin() + (last - begin()), end(), target);
+			PopBack(static_cast<int>(last - first));
+			return target;
+		}
+
+		void reserve(int count) {
+			container.reserve(count);
+		}
+		inline int size() const {
+			return static_cast<int>(container.size());
+		}
+		inline bool empty() const {
+			return size() == 0;
+		}
+		void clear() {
+			container.clear();
+		}
+
+	protected:
+		// ̺ Ž (ܰ踶   )
+		template <class Key>
+		int LowerIndex(const Key &key) const {
+			const_iterator base = begin();
+			int low = 0, high = size();
+			while (low < high) {
+				int mid = (low + high) / 2;
+				if (compare(KeyOf(base[mid]), key))
+					low = mid + 1;
+				else
+					high = mid;
+			}
+			return low;
+		}
+		template <class Key>
+		int UpperIndex(const Key &key) const {
+			const_iterator base = begin();
+			int low = 0, high = size();
+			while (low < high) {
+				int mid = (low + high) / 2;
+				if (compare(key, KeyOf(base[mid])))
+					high = mid;
+				else
+					low = mid + 1;
+			}
+			return low;
+		}
+		template <class Key>
+		int FindIndex(const Key &key) const {
+			int index = LowerIndex(key);
+			if (index == size() || compare(key, KeyOf(begin()[index]))) // key < value
+				return size();
+			return index;
+		}
+
+		template <class V>
+		void InsertValue(V &&value) {
+			int index = LowerIndex(KeyOf(value));
+			if (index < size() && !compare(KeyOf(value), KeyOf(begin()[index])))
+				return;
+
+			// ڿ ְ ڸ ȸ
+			container.push_back(std::forward<V>(value));
+			std::rotate(begin() + index, end() - 1, end());
+		}
+		// key ڸ   Ž,  Ű   args    ڸ  (  ҿ false)
+		template <class... Args>
+		std::pair<iterator, bool> EmplaceKey(const key_type &key, Args &&...args) {
+			int index = LowerIndex(key);
+			if (index < size() && !compare(key, KeyOf(begin()[index])))
+				return std::make_pair(begin() + index, false);
+
+			container.push_back(T(std::forward<Args>(args)...));
+			std::rotate(begin() + index, end() - 1, end());
+			return std::make_pair(begin() + index, true);
+		}
+		// ̹ ĵǾ ְ ߺ   ڿ 
+		template <class _Iter>
+		void AppendSorted(_Iter first, const _Iter &last) {
+			for (; first != last; ++first)
+				container.push_back(*first);
+		}
+		void PopBack(int count) {
+			while (count-- > 0)
+				container.pop_back();
+		}
+
+		static const key_type &KeyOf(const T &value) {
+			return KeyOfValue()(value);
+		}
+
+		class ValueCompare {
+		public:
+			explicit ValueCompare(const Compare &compare) : compare(compare) {
+			}
+
+			bool operator()(const T &left, const T &right) const {
+				return compare(KeyOf(left), KeyOf(right));
+			}
+
+		private:
+			const Compare &compare;
+		};
+
+	protected:
+		Container container;
+		Compare compare;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,568 @@
+#pragma once
+
+#include <cstdlib>
+
+namespace bon {
+	//  å:  height ʵ带 ũ  (nullptr 0, ܸ 1)
+	// ũ (θ ũ - ڽ ũ) d ڽ d-ڽ̶ θ
+	//
+	// insert_fixup(target, header, update)	ܸ  target  
+	// erase_fixup(parent, header, update)	ڽ ڸ ϳ (Ǵ  ܰ ) parent  
+	// join(left, pivot, right, update)		left < pivot < right  Ʈ ģ Ʈ ȯ (Ʈ θ nullptr)
+	// build_rank(target)					   Ʈ ڽ ũ target ũ 
+	// min_size(rank)						ũ rank Ʈ   ִ ּ   (  )
+	//
+	// header Ʈ θ (ű⼭ ), update ڽ ٲ    ٽ ϴ Լ ü
+	//   ȸ 常 ϹǷ, / ġ  Ʈ Ʈ ٽ ؾ 
+	struct balance_base {
+		template <class Node>
+		static int RankOf(const Node *target) {
+			return (target != nullptr) ? target->height : 0;
+		}
+		template <class Node>
+		static Node *SiblingOf(Node *parent, Node *child) {
+			return (parent->left == child) ? parent->right : parent->left;
+		}
+
+		// target θ ڸ ø  ȸ (ũ ٲ )
+		template <class Node, class Update>
+		static void Rotate(Node *target, Update &update) {
+			Node *parent = target->parent;
+			Node *grand = parent->parent;
+
+			if (parent->left == target) {
+				parent->left = target->right;
+				if (target->right != nullptr)
+					target->right->parent = parent;
+				target->right = parent;
+			}
+			else {
+				parent->right = target->left;
+				if (target->left != nullptr)
+					target->left->parent = parent;
+				target->left = parent;
+			}
+
+			parent->parent = target;
+			target->parent = grand;
+			if (grand->left == parent)
+				grand->left = target;
+			else
+				grand->right = target;
+
+			update(parent);
+			update(target);
+		}
+
+		// ģ  pivot    ٽ 
+		template <class Node, class Update>
+		static void UpdateToTop(Node *target, Node *top, Update &update) {
+			for (; target != top; target = target->parent)
+				update(target);
+		}
+		template <class Node>
+		static Node *Link(Node *left, Node *pivot, Node *right) {
+			pivot->left = left;
+			pivot->right = right;
+			if (left != nullptr) left->parent = pivot;
+			if (right != nullptr) right->parent = pivot;
+			return pivot;
+		}
+	};
+
+	// AVL: ũ ,  ڽ   1 
+	// ȸ  ( 1.44 log n )   ȸ O(log n) Ͼ  
+	struct avl_balance : balance_base {
+		// ̸ ٽ ϸ ö󰡴ٰ ̰ ״ 忡  (  ȸϸ κ Ʈ ̴   ƿ)
+		template <class Node, class Update>
+		static void insert_fixup(Node *target, Node *header, Update update) {
+			target = target->parent;
+			while (target != header) {
+				int oldHeight = target->height;
+				RecalcHeight(target);
+
+				if (abs(BalanceOf(target)) >= 2) {
+					MaintainBalance(target, update);
+					return;
+				}
+				if (target->height == oldHeight)
+					return;
+
+				target = target->parent;
+			}
+		}
+		//  Ŀ ȸص ̰   Ƿ ̰ ״ 忡 
+		template <class Node, class Update>
+		static void erase_fixup(Node *target, Node *header, Update update) {
+			while (target != header) {
+				int oldHeight = target->height;
+				RecalcHeight(target);
+
+				if (abs(BalanceOf(target)) >= 2)
+					target = MaintainBalance(target, update);
+				if (target->height == oldHeight)
+					return;
+
+				target = target->parent;
+			}
+		}
+
+		// left < pivot < right  AVL Ʈ O(| |) ħ
+		//   ̿ ´    踦    ,    
+		template <class Node, class Update>
+		static Node *join(Node *left, Node *pivot, Node *right, Update update) {
+			int leftHeight = RankOf(left);
+			int rightHeight = RankOf(right);
+
+			Node *result;
+			if (leftHeight > rightHeight + 1 || rightHeight > leftHeight + 1) {
+				Node top; // ġ  Ʈ ӽ θ
+				Node *parent = &top;
+				Node *curr;
+
+				if (leftHeight > rightHeight) {
+					top.right = left;
+					left->parent = &top;
+					for (curr = left; RankOf(curr) > rightHeight + 1; curr = curr->right)
+						parent = curr;
+					parent->right = Link(curr, pivot, right);
+				}
+				else {
+					top.left = right;
+					right->parent = &top;
+					for (curr = right; RankOf(curr) > leftHeight + 1; curr = curr->left)
+						parent = curr;
+					parent->left = Link(left, pivot, curr);
+				}
+				pivot->parent = parent;
+				RecalcHeight(pivot);
+				update(pivot);
+
+				Node *target = parent;
+				while ((target = GetUnbalancedNodeWithRecalcHeight(target, &top, update)) != nullptr)
+					target = MaintainBalance(target, update);
+
+				result = (leftHeight > rightHeight) ? top.right : top.left;
+			}
+			else {
+				result = Link(left, pivot, right);
+				RecalcHeight(pivot);
+				update(pivot);
+			}
+
+			result->parent = nullptr;
+			return result;
+		}
+
+		//  h AVL Ʈ ּ   N(h) = N(h-1) + N(h-2) + 1
+		static long long min_size(int rank) {
+			long long prev = 0, curr = (rank > 0) ? 1 : 0;
+			for (int h = 2; h <= rank; h++) {
+				long long next = prev + curr + 1;
+				prev = curr;
+				curr = next;
+			}
+			return curr;
+		}
+
+		template <class Node>
+		static void build_rank(Node *target) {
+			RecalcHeight(target);
+		}
+
+	private:
+		template <class Node>
+		static int BalanceOf(Node *target) {
+			return RankOf(target->right) - RankOf(target->left);
+		}
+		template <class Node>
+		static void RecalcHeight(Node *target) {
+			int leftHeight = RankOf(target->left);
+			int rightHeight = RankOf(target->right);
+
+			target->height = (leftHeight > rightHeight) ? leftHeight+1 : rightHeight+1;
+		}
+
+		//   2 带   籸(trinode restructuring) ϰ  κ Ʈ Ʈ ȯ
+		template <class Node, class Update>
+		static Node *MaintainBalance(Node *target, Update &update) {
+			Node *x, *y, *z;
+			Node *a, *b, *c;
+			Node *t0, *t1, *t2, *t3;
+
+			z = target;
+			if (BalanceOf(z) < 0) {
+				y = z->left;
+				if (BalanceOf(y) <= 0) { //   y (0)̸  ȸ
+					x = y->left;
+
+					a = x;
+					b = y;
+					c = z;
+
+					t0 = x->left;
+					t1 = x->right;
+					t2 = y->right;
+					t3 = z->right;
+				} else {
+					x = y->right;
+
+					a = y;
+					b = x;
+					c = z;
+
+					t0 = y->left;
+					t1 = x->left;
+					t2 = x->right;
+					t3 = z->right;
+				}
+			} else {
+				y = z->right;
+				if (BalanceOf(y) < 0) {
+					x = y->left;
+
+					a = z;
+					b = x;
+					c = y;
+
+					t0 = z->left;
+					t1 = x->left;
+					t2 = x->right;
+					t3 = y->right;
+				} else {
+					x = y->right;
+
+					a = z;
+					b = y;
+					c = x;
+
+					t0 = z->left;
+					t1 = y->left;
+					t2 = x->left;
+					t3 = x->right;
+				}
+			}
+
+			Node *parent = z->parent;
+
+			a->parent = b;
+			a->left = t0;
+			a->right = t1;
+			RecalcHeight(a);
+			update(a);
+			if (t0 != nullptr) t0->parent = a;
+			if (t1 != nullptr) t1->parent = a;
+
+			c->parent = b;
+			c->left = t2;
+			c->right = t3;
+			RecalcHeight(c);
+			update(c);
+			if (t2 != nullptr) t2->parent = c;
+			if (t3 != nullptr) t3->parent = c;
+
+			b->parent = parent;
+			b->left = a;
+			b->right = c;
+			RecalcHeight(b);
+			update(b);
+
+			if (parent->left == z)
+				parent->left = b;
+			else
+				parent->right = b;
+
+			return b;
+		}
+		// stop ϸ  ´   nullptr ȯ
+		template <class Node, class Update>
+		static Node *GetUnbalancedNodeWithRecalcHeight(Node *target, Node *stop, Update &update) {
+			while (target != stop) {
+				RecalcHeight(target);
+				update(target);
+				if (abs(BalanceOf(target)) >= 2)
+					return target;
+				target = target->parent;
+			}
+
+			return nullptr;
+		}
+	};
+
+	//  AVL(WAVL):  ũ ̰ 1 Ǵ 2̰ ܸ ũ 1
+	// Ը ϸ AVL  Ʈ Ǹ, ԰   ȸ ִ  , ũ   ȯ O(1)
+	struct wavl_balance : balance_base {
+		// target 0-ڽ   1-ڽ̸ θ °ϸ ö󰡰, 2-ڽ̸ ȸϰ 
+		template <class Node, class Update>
+		static void insert_fixup(Node *target, Node *header, Update update) {
+			while (true) {
+				Node *parent = target->parent;
+				if (parent == header || parent->height != target->height)
+					return;
+
+				if (parent->height - RankOf(SiblingOf(parent, target)) == 1) {
+					parent->height++;
+					target = parent;
+					continue;
+				}
+
+				// target 1,2 :  ڽ 2-ڽ̸  ȸ, 1-ڽ̸  ȸ
+				Node *inner = (parent->left == target) ? target->right : target->left;
+				if (target->height - RankOf(inner) == 2) {
+					Rotate(target, update);
+					parent->height--;
+				}
+				else {
+					Rotate(inner, update);
+					Rotate(inner, update);
+					inner->height++;
+					target->height--;
+					parent->height--;
+				}
+				return;
+			}
+		}
+		// 2,2 ܸ ϰ, 3-ڽ    ϸ ö󰡰ų ȸϰ 
+		template <class Node, class Update>
+		static void erase_fixup(Node *parent, Node *header, Update update) {
+			if (parent == header)
+				return;
+			if (parent->left == nullptr && parent->right == nullptr && parent->height == 2) {
+				parent->height = 1;
+				parent = parent->parent;
+			}
+
+			while (parent != header) {
+				bool bLeft;
+				if (parent->height - RankOf(parent->left) == 3)
+					bLeft = true;
+				else if (parent->height - RankOf(parent->right) == 3)
+					bLeft = false;
+				else
+					return;
+
+				Node *sibling = bLeft ? parent->right : parent->left;
+				if (parent->height - sibling->height == 2) {
+					parent->height--;
+					parent = parent->parent;
+					continue;
+				}
+
+				Node *nearChild = bLeft ? sibling->left : sibling->right;
+				Node *farChild = bLeft ? sibling->right : sibling->left;
+				if (sibling->height - RankOf(nearChild) == 2 && sibling->height - RankOf(farChild) == 2) {
+					parent->height--;
+					sibling->height--;
+					parent = parent->parent;
+					continue;
+				}
+
+				if (sibling->height - RankOf(farChild) == 1) {
+					Rotate(sibling, update);
+					sibling->height++;
+					parent->height--;
+					if (parent->left == nullptr && parent->right == nullptr)
+						parent->height = 1;
+				}
+				else {
+					Rotate(nearChild, update);
+					Rotate(nearChild, update);
+					nearChild->height += 2;
+					sibling->height--;
+					parent->height -= 2;
+				}
+				return;
+			}
+		}
+
+		//   踦  ũ   + 1    pivot 
+		// pivot 1,1 Ǵ 1,2 ̹Ƿ, θ 0-ڽ Ǹ ԰   
+		template <class Node, class Update>
+		static Node *join(Node *left, Node *pivot, Node *right, Update update) {
+			int leftRank = RankOf(left);
+			int rightRank = RankOf(right);
+
+			if (abs(leftRank - rightRank) <= 1) {
+				Link(left, pivot, right);
+				pivot->height = ((leftRank > rightRank) ? leftRank : rightRank) + 1;
+				update(pivot);
+				pivot->parent = nullptr;
+				return pivot;
+			}
+
+			Node top; // ġ  Ʈ ӽ θ
+			Node *parent = &top;
+			Node *curr;
+			if (leftRank > rightRank) {
+				top.right = left;
+				left->parent = &top;
+				for (curr = left; RankOf(curr) > rightRank + 1; curr = curr->right)
+					parent = curr;
+				parent->right = Link(curr, pivot, right);
+			}
+			else {
+				top.left = right;
+				right->parent = &top;
+				for (curr = right; RankOf(curr) > leftRank + 1; curr = curr->left)
+					parent = curr;
+				parent->left = Link(left, pivot, curr);
+			}
+			pivot->parent = parent;
+			pivot->height = RankOf(curr) + 1;
+			update(pivot);
+
+			insert_fixup(pivot, &top, update);
+			UpdateToTop(pivot, &top, update);
+
+			Node *result = (leftRank > rightRank) ? top.right : top.left;
+			result->parent = nullptr;
+			return result;
+		}
+
+		//  ڽ  2-ڽ   : m(r) = 2m(r-2) + 1 (m(1) = 1, m(2) = 2),  2^(r/2)
+		static long long min_size(int rank) {
+			if (rank <= 0)
+				return 0;
+
+			long long size = (rank % 2 == 1) ? 1 : 2;
+			for (int r = (rank % 2 == 1) ? 3 : 4; r <= rank; r += 2)
+				size = size * 2 + 1;
+			return size;
+		}
+
+		template <class Node>
+		static void build_rank(Node *target) {
+			int leftRank = RankOf(target->left);
+			int rightRank = RankOf(target->right);
+
+			target->height = ((leftRank > rightRank) ? leftRank : rightRank) + 1;
+		}
+	};
+
+	// -: ũ  ,  ũ ̰ 0 Ǵ 1̰ 0-ڽ() ڽ  1-ڽ()
+	// ̰ 2 log n Ŀ   ԰   ȸ ִ μ ̰ ũ   ȯ O(1)
+	struct rb_balance : balance_base {
+		// θ ڽ  0-ڽ :  0-ڽ̸ θ °ϸ ö󰡰, ƴϸ ȸϰ 
+		template <class Node, class Update>
+		static void insert_fixup(Node *target, Node *header, Update update) {
+			while (true) {
+				Node *parent = target->parent;
+				if (parent == header || parent->height != target->height)
+					return;
+				Node *grand = parent->parent;
+				if (grand == header || grand->height != parent->height)
+					return;
+
+				if (RankOf(SiblingOf(grand, parent)) == grand->height) {
+					grand->height++;
+					target = grand;
+					continue;
+				}
+
+				bool bInner = (grand->left == parent) != (parent->left == target);
+				if (bInner) {
+					Rotate(target, update);
+					Rotate(target, update);
+				}
+				else
+					Rotate(parent, update);
+				return;
+			}
+		}
+		// 2-ڽ( )   ˰  ,  ڽĿ  ȸϰ ų θ ϸ ö
+		template <class Node, class Update>
+		static void erase_fixup(Node *parent, Node *header, Update update) {
+			while (parent != header) {
+				bool bLeft;
+				if (parent->height - RankOf(parent->left) == 2)
+					bLeft = true;
+				else if (parent->height - RankOf(parent->right) == 2)
+					bLeft = false;
+				else
+					return;
+
+				Node *sibling = bLeft ? parent->right : parent->left;
+				if (sibling->height == parent->height) {
+					Rotate(sibling, update);
+					continue;
+				}
+
+				Node *nearChild = bLeft ? sibling->left : sibling->right;
+				Node *farChild = bLeft ? sibling->right : sibling->left;
+				if (RankOf(farChild) == sibling->height) {
+					Rotate(sibling, update);
+					sibling->height++;
+					parent->height--;
+					return;
+				}
+				if (RankOf(nearChild) == sibling->height) {
+					Rotate(nearChild, update);
+					continue;
+				}
+
+				bool bZeroChild = parent->parent != header && parent->parent->height == parent->height;
+				parent->height--;
+				if (bZeroChild)
+					return;
+				parent = parent->parent;
+			}
+		}
+
+		//   踦   ʰ ũ  ù   pivot 0-ڽ ̰ ԰   
+		template <class Node, class Update>
+		static Node *join(Node *left, Node *pivot, Node *right, Update update) {
+			int leftRank = RankOf(left);
+			int rightRank = RankOf(right);
+
+			if (leftRank == rightRank) {
+				Link(left, pivot, right);
+				pivot->height = leftRank + 1;
+				update(pivot);
+				pivot->parent = nullptr;
+				return pivot;
+			}
+
+			Node top; // ġ  Ʈ ӽ θ
+			Node *parent = &top;
+			Node *curr;
+			if (leftRank > rightRank) {
+				top.right = left;
+				left->parent = &top;
+				for (curr = left; RankOf(curr) > rightRank; curr = curr->right)
+					parent = curr;
+				parent->right = Link(curr, pivot, right);
+			}
+			else {
+				top.left = right;
+				right->parent = &top;
+				for (curr = right; RankOf(curr) > leftRank; curr = curr->left)
+					parent = curr;
+				parent->left = Link(left, pivot, curr);
+			}
+			pivot->parent = parent;
+			pivot->height = RankOf(curr) + 1;
+			update(pivot);
+
+			insert_fixup(pivot, &top, update);
+			UpdateToTop(pivot, &top, update);
+
+			Node *result = (leftRank > rightRank) ? top.right : top.left;
+			result->parent = nullptr;
+			return result;
+		}
+
+		//   b Ʈ     Ʈ   : 2^b - 1
+		static long long min_size(int rank) {
+			return (rank > 0) ? (1LL << rank) - 1 : 0;
+		}
+
+		//   Ʈ ܸ ̰ ƾ 1 ̹Ƿ,   ܸ ̸  ̷       
+		template <class Node>
+		static void build_rank(Node *target) {
+			int leftRank = RankOf(target->left);
+			int rightRank = RankOf(target->right);
+
+			target->height = ((leftRank < rightRank) ? leftRank : rightRank) + 1;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include "BTree.hpp"
+
+namespace bon {
+	template <typename K, typename V, class Compare = std::less<K>, class Allocator = pool_allocator<std::pair<K, V>>, size_t NodeBytes = 256>
+	class btree_map : public BTree<std::pair<K, V>, Compare, Allocator, select_first<K, V>, NodeBytes> {
+	public:
+		using T = std::pair<K, V>;
+		using Tree = BTree<T, Compare, Allocator, select_first<K, V>, NodeBytes>;
+
+		using iterator = typename Tree::iterator;
+
+		btree_map() : Tree() {
+		}
+		btree_map(std::initializer_list<T> initList) : Tree(initList.begin(), initList.end()) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		btree_map(const _Iter &first, const _Iter &last) : Tree(first, last) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		btree_map(sorted_unique_t tag, const _Iter &first, const _Iter &last) : Tree(tag, first, last) {
+		}
+		btree_map(const btree_map &tree) : Tree(tree) {
+		}
+		btree_map(btree_map &&tree) noexcept : Tree(std::move(tree)) {
+		}
+
+		btree_map &operator=(const btree_map &tree) {
+			Tree::operator=(tree);
+			return *this;
+		}
+		btree_map &operator=(btree_map &&tree) {
+			Tree::operator=(std::move(tree));
+			return *this;
+		}
+
+		V &at(const K &key) {
+			iterator iter = this->find(key);
+			if (iter == this->end())
+				throw new std::out_of_range("btree_map::at() called with a missing key");
+			return iter->second;
+		}
+		const V &at(const K &key) const {
+			iterator iter = this->find(key);
+			if (iter == this->end())
+				throw new std::out_of_range("btree_map::at() called with a missing key");
+			return iter->second;
+		}
+		//  ⺻  (Ž  )
+		V &operator[](const K &key) {
+			return try_emplace(key).first->second;
+		}
+		V &operator[](K &&key) {
+			return try_emplace(std::move(key)).first->second;
+		}
+
+		// Ű   ã ڸ (key, V(args...))  ,  args  
+		template <class... Args>
+		std::pair<iterator, bool> try_emplace(const K &key, Args &&...args) {
+			return this->EmplaceKey(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+		}
+		template <class... Args>
+		std::pair<iterator, bool> try_emplace(K &&key, Args &&...args) {
+			return this->EmplaceKey(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <utility>
+#include "BTree.hpp"
+
+namespace bon {
+	template <typename T, class Compare = std::less<T>, class Allocator = pool_allocator<T>, size_t NodeBytes = 256>
+	class btree_set : public BTree<T, Compare, Allocator, identity_key<T>, NodeBytes> {
+	public:
+		using Tree = BTree<T, Compare, Allocator, identity_key<T>, NodeBytes>;
+
+		btree_set() : Tree() {
+		}
+		btree_set(std::initializer_list<T> initList) : Tree(initList) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		btree_set(const _Iter &first, const _Iter &last) : Tree(first, last) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		btree_set(sorted_unique_t tag, const _Iter &first, const _Iter &last) : Tree(tag, first, last) {
+		}
+		btree_set(const btree_set &right) : Tree(right) {
+		}
+		btree_set(btree_set &&right) noexcept : Tree(std::move(right)) {
+		}
+
+		btree_set &operator=(const btree_set &right) {
+			Tree::operator=(right);
+			return *this;
+		}
+		btree_set &operator=(btree_set &&right) {
+			Tree::operator=(std::move(right));
+			return *this;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "persistent_map.hpp"
+
+namespace bon {
+	// б  ʴ  writer  
+	// writer persistent_map        Խϰ,
+	// б Խõ  ״ Ž (RCU )
+	// ü  ũ  ȸ(epoch-based reclamation)   д 尡    
+	// Ⳣ mutex ȭϸ, б writer mutex ٸ 
+	template <typename K, typename V, class Compare = std::less<K>, class Allocator = std::allocator<std::pair<K, V>>>
+	class concurrent_map {
+	public:
+		using T = std::pair<K, V>;
+		using snapshot_type = persistent_map<K, V, Compare, Allocator>;
+
+	private:
+		static const size_t CACHE_LINE_SIZE = 64;
+		static const int SLOT_COUNT = 64;
+
+		// 庰(ؽ÷ ) б  , ũ Ȧ¦  
+		struct alignas(CACHE_LINE_SIZE) reader_slot {
+			std::atomic<int> count[2];
+		};
+		struct retired_version {
+			snapshot_type *version;
+			unsigned epoch;
+		};
+
+		// д  Խõ   ʵ 
+		class read_guard {
+		public:
+			explicit read_guard(const concurrent_map &owner) : slot(owner.slots[SlotIndex()]) {
+				while (true) {
+					epoch = owner.epoch.load(std::memory_order_seq_cst);
+					slot.count[epoch & 1].fetch_add(1, std::memory_order_seq_cst);
+
+					// Ű ̿ ũ Ѿ writer  б⸦    Ƿ ٽ õ
+					if (owner.epoch.load(std::memory_order_seq_cst) == epoch)
+						break;
+					slot.count[epoch & 1].fetch_sub(1, std::memory_order_relaxed);
+				}
+			}
+			~read_guard() {
+				slot.count[epoch & 1].fetch_sub(1, std::memory_order_release);
+			}
+
+			read_guard(const read_guard &) = delete;
+			read_guard &operator=(const read_guard &) = delete;
+
+		private:
+			reader_slot &slot;
+			unsigned epoch;
+		};
+
+	public:
+		concurrent_map(const Allocator &allocator = Allocator()) : current(allocator) {
+			epoch.store(0);
+			for (auto &slot : slots) {
+				slot.count[0].store(0);
+				slot.count[1].store(0);
+			}
+
+			published.store(new snapshot_type(current));
+		}
+		concurrent_map(std::initializer_list<T> initList, const Allocator &allocator = Allocator()) : concurrent_map(allocator) {
+			update([&](snapshot_type &target) {
+				for (const T &value : initList)
+					target.insert(value);
+			});
+		}
+		concurrent_map(const concurrent_map &) = delete;
+		// б  尡  
+		~concurrent_map() {
+			for (auto &retired : retiredVersions)
+				delete retired.version;
+			delete published.load();
+		}
+
+		concurrent_map &operator=(const concurrent_map &) = delete;
+
+		//  (Խ  ȯǹǷ  б  )
+		bool insert(const T &value) {
+			bool bInserted = false;
+			update([&](snapshot_type &target) { bInserted = target.insert(value); });
+			return bInserted;
+		}
+		bool insert_or_assign(const K &key, const V &value) {
+			bool bInserted = false;
+			update([&](snapshot_type &target) { bInserted = target.insert_or_assign(key, value); });
+			return bInserted;
+		}
+		int erase(const K &key) {
+			int count = 0;
+			update([&](snapshot_type &target) { count = target.erase(key); });
+			return count;
+		}
+		void clear() {
+			update([](snapshot_type &target) { target.clear(); });
+		}
+		//      Խ (б ߰ ¸  )
+		template <class Func>
+		void update(Func &&func) {
+			std::lock_guard<std::mutex> lock(writeMutex);
+			snapshot_type next(current);
+
+			func(next);
+			Publish(std::move(next));
+		}
+
+		// б ( )
+		// func Խõ  const  , ȯ ڿ   ݺڸ   
+		template <class Func>
+		auto read(Func &&func) const -> decltype(func(std::declval<const snapshot_type &>())) {
+			read_guard guard(*this);
+			return func(*published.load(std::memory_order_acquire));
+		}
+		bool find(const K &key, V &value) const {
+			return read([&](const snapshot_type &target) {
+				auto iter = target.find(key);
+				if (iter == target.end())
+					return false;
+
+				value = iter->second;
+				return true;
+			});
+		}
+		bool contains(const K &key) const {
+			return read([&](const snapshot_type &target) { return target.contains(key); });
+		}
+		int size() const {
+			return read([](const snapshot_type &target) { return target.size(); });
+		}
+		bool empty() const {
+			return size() == 0;
+		}
+		//  ȸ     (O(1),      ڽ )
+		snapshot_type snapshot() const {
+			return read([](const snapshot_type &target) { return target.snapshot(); });
+		}
+
+	private:
+		static int SlotIndex() {
+			static thread_local int index = static_cast<int>(std::hash<std::thread::id>()(std::this_thread::get_id()) % SLOT_COUNT);
+			return index;
+		}
+
+		void Publish(snapshot_type &&next) {
+			snapshot_type *version = new snapshot_type(std::move(next));
+			current = *version;
+
+			snapshot_type *previous = published.exchange(version, std::memory_order_acq_rel);
+			retiredVersions.push_back({ previous, epoch.load(std::memory_order_relaxed) });
+
+			Reclaim();
+		}
+		//  ũ бⰡ   ũ ѱ,  ũ  ü  
+		void Reclaim() {
+			unsigned currentEpoch = epoch.load(std::memory_order_relaxed);
+			for (auto &slot : slots) {
+				if (slot.count[(currentEpoch + 1) & 1].load(std::memory_order_seq_cst) != 0)
+					return;
+			}
+
+			epoch.store(currentEpoch + 1, std::memory_order_seq_cst);
+
+			size_t kept = 0;
+			for (size_t i = 0; i < retiredVersions.size(); i++) {
+				if (currentEpoch - retiredVersions[i].epoch >= 1)
+					delete retiredVersions[i].version;
+				else
+					retiredVersions[kept++] = retiredVersions[i];
+			}
+			retiredVersions.resize(kept);
+		}
+
+	private:
+		snapshot_type current; // writer  ֽ 
+		std::atomic<snapshot_type *> published;
+		std::atomic<unsigned> epoch;
+		mutable reader_slot slots[SLOT_COUNT];
+
+		std::mutex writeMutex;
+		std::vector<retired_version> retiredVersions;
+	};
+}
\ No newline at end of file
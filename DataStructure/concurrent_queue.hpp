@@ -0,0 +1,158 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace bon {
+	//  ũ lock-free MPMC ť (Dmitry Vyukov bounded queue)
+	//  尡 ÿ Ƿ front()  ʰ, pop  Ѱ
+	template <typename T>
+	class concurrent_queue {
+	private:
+		static const size_t CACHE_LINE_SIZE = 64;
+
+		class cell {
+		public:
+			std::atomic<size_t> sequence;
+			alignas(T) unsigned char storage[sizeof(T)];
+
+			T *value() {
+				return reinterpret_cast<T *>(storage);
+			}
+		};
+
+	public:
+		explicit concurrent_queue(size_t capacity = 1024) {
+			if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+				throw std::invalid_argument("concurrent_queue capacity must be a power of two");
+
+			mask = capacity - 1;
+			cells = new cell[capacity];
+			for (size_t i = 0; i < capacity; i++)
+				cells[i].sequence.store(i, std::memory_order_relaxed);
+
+			enqueuePos.store(0, std::memory_order_relaxed);
+			dequeuePos.store(0, std::memory_order_relaxed);
+		}
+		concurrent_queue(const concurrent_queue &) = delete;
+		~concurrent_queue() {
+			size_t first = dequeuePos.load(std::memory_order_relaxed);
+			size_t last = enqueuePos.load(std::memory_order_relaxed);
+			for (size_t pos = first; pos != last; pos++)
+				cells[pos & mask].value()->~T();
+
+			delete[] cells;
+		}
+
+		concurrent_queue &operator=(const concurrent_queue &) = delete;
+
+		bool try_push(const T &value) {
+			return try_emplace(value);
+		}
+		bool try_push(T &&value) {
+			return try_emplace(std::move(value));
+		}
+		template <class... Args>
+		bool try_emplace(Args &&...args) {
+			size_t pos = enqueuePos.load(std::memory_order_relaxed);
+			cell *target;
+
+			while (true) {
+				target = &cells[pos & mask];
+				size_t sequence = target->sequence.load(std::memory_order_acquire);
+				intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+				if (diff == 0) {
+					if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0)
+					return false; //  
+				else
+					pos = enqueuePos.load(std::memory_order_relaxed);
+			}
+
+			new (target->storage) T(std::forward<Args>(args)...);
+			target->sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+		bool try_pop(T &value) {
+			size_t pos = dequeuePos.load(std::memory_order_relaxed);
+			cell *target;
+
+			while (true) {
+				target = &cells[pos & mask];
+				size_t sequence = target->sequence.load(std::memory_order_acquire);
+				intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+				if (diff == 0) {
+					if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0)
+					return false; //  
+				else
+					pos = dequeuePos.load(std::memory_order_relaxed);
+			}
+
+			value = std::move(*target->value());
+			target->value()->~T();
+			target->sequence.store(pos + mask + 1, std::memory_order_release);
+			return true;
+		}
+
+		//    
+		void push(const T &value) {
+			emplace(value);
+		}
+		void push(T &&value) {
+			emplace(std::move(value));
+		}
+		template <class... Args>
+		void emplace(Args &&...args) {
+			for (int spin = 0; !try_emplace(std::forward<Args>(args)...); spin++)
+				backoff(spin);
+		}
+		// Ұ   
+		void pop(T &value) {
+			for (int spin = 0; !try_pop(value); spin++)
+				backoff(spin);
+		}
+
+		// ٸ 尡 ÿ ϴ ߿ ٻ
+		int size() const {
+			size_t enqueued = enqueuePos.load(std::memory_order_acquire);
+			size_t dequeued = dequeuePos.load(std::memory_order_acquire);
+			return (enqueued > dequeued) ? static_cast<int>(enqueued - dequeued) : 0;
+		}
+		bool empty() const {
+			return size() == 0;
+		}
+		size_t capacity() const {
+			return mask + 1;
+		}
+
+	private:
+		static void backoff(int spin) {
+			if (spin < 64)
+				std::this_thread::yield();
+			else
+				std::this_thread::sleep_for(std::chrono::microseconds(50));
+		}
+
+	private:
+		cell *cells;
+		size_t mask;
+
+		// ڿ Һ ġ  ĳ   ʵ и
+		alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos;
+		alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos;
+		char padding[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+	};
+}
\ No newline at end of file
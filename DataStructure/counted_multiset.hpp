@@ -0,0 +1,211 @@
+#pragma once
+
+#include <functional>
+#include <iterator>
+#include <utility>
+#include "AVLTree.hpp"
+
+namespace bon {
+	//     Ƚ
+	template <typename T>
+	struct counted_value {
+		T value;
+		int count;
+	};
+	template <typename T>
+	struct counted_key {
+		using key_type = T;
+
+		const T &operator()(const counted_value<T> &target) const {
+			return target.value;
+		}
+	};
+
+	//    ϳ   ϴ ߺ  
+	// ̹ ִ   Ž    ,      ϳ 
+	// ȸ  ŭ ݺؼ  (   Ƿ   Ҹ Ŵ)
+	template <typename T, class Compare = std::less<T>, class Allocator = pool_allocator<counted_value<T>>, class Balance = avl_balance>
+	class counted_multiset {
+	public:
+		using Tree = AVLTree<counted_value<T>, Compare, Allocator, counted_key<T>, no_augment, Balance>;
+		using key_type = T;
+
+		class iterator {
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type		= T;
+			using difference_type	= int;
+			using pointer			= const T *;
+			using reference			= const T &;
+
+			iterator() : copy(0) {
+			}
+			iterator(const typename Tree::iterator &node, int copy) : node(node), copy(copy) {
+			}
+
+			iterator &operator++() {
+				if (++copy == node->count) {
+					++node;
+					copy = 0;
+				}
+				return *this;
+			}
+			const iterator operator++(int) {
+				iterator result(*this);
+				++(*this);
+				return result;
+			}
+			iterator &operator--() {
+				if (copy > 0)
+					copy--;
+				else {
+					--node;
+					copy = node->count - 1;
+				}
+				return *this;
+			}
+			const iterator operator--(int) {
+				iterator result(*this);
+				--(*this);
+				return result;
+			}
+
+			bool operator==(const iterator &iter) const {
+				return node == iter.node && copy == iter.copy;
+			}
+			bool operator!=(const iterator &iter) const {
+				return !(*this == iter);
+			}
+
+			const T &operator*() const {
+				return node->value;
+			}
+			const T *operator->() const {
+				return &node->value;
+			}
+
+		public:
+			typename Tree::iterator node;
+			int copy; //     ° (0)
+		};
+
+	public:
+		counted_multiset() : tree(ALLOW_DUPLICATION), compare(Compare()) {
+			length = 0;
+		}
+		counted_multiset(std::initializer_list<T> initList) : counted_multiset(initList.begin(), initList.end()) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		counted_multiset(const _Iter &first, const _Iter &last) : counted_multiset() {
+			insert(first, last);
+		}
+		counted_multiset(const counted_multiset &target) : tree(target.tree), compare(target.compare) {
+			length = target.length;
+		}
+		counted_multiset(counted_multiset &&target) noexcept : tree(std::move(target.tree)), compare(target.compare) {
+			length = target.length;
+			target.length = 0;
+		}
+
+		counted_multiset &operator=(const counted_multiset &target) {
+			tree = target.tree;
+			length = target.length;
+			return *this;
+		}
+		counted_multiset &operator=(counted_multiset &&target) {
+			if (this == &target)
+				return *this;
+
+			tree = std::move(target.tree);
+			length = target.length;
+			target.length = 0;
+			return *this;
+		}
+
+		iterator begin() const {
+			return iterator(tree.begin(), 0);
+		}
+		iterator end() const {
+			return iterator(tree.end(), 0);
+		}
+
+		//    ù ° Ŵ
+		iterator find(const key_type &key) const {
+			return iterator(tree.find(key), 0);
+		}
+		iterator lower_bound(const key_type &key) const {
+			return iterator(tree.lower_bound(key), 0);
+		}
+		iterator upper_bound(const key_type &key) const {
+			return iterator(tree.upper_bound(key), 0);
+		}
+		//   Ƿ O(log n)
+		int count(const key_type &key) const {
+			typename Tree::iterator target = tree.find(key);
+			return (target != tree.end()) ? target->count : 0;
+		}
+
+		// ̹   ø,  lower_bound ġ hint ٷ  (Ž  )
+		void insert(const T &value, int copies = 1) {
+			if (copies <= 0)
+				return;
+
+			typename Tree::iterator target = tree.lower_bound(value);
+			if (target != tree.end() && !compare(value, target->value))
+				target->count += copies;
+			else
+				tree.insert(target, counted_value<T>{ value, copies });
+			length += copies;
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		void insert(const _Iter &first, const _Iter &last) {
+			for (auto targetIter = first; targetIter != last; targetIter++)
+				insert(*targetIter);
+		}
+
+		//       ȯ
+		int erase(const key_type &key) {
+			typename Tree::iterator target = tree.find(key);
+			if (target == tree.end())
+				return 0;
+
+			int copies = target->count;
+			tree.erase(target);
+			length -= copies;
+			return copies;
+		}
+		// ϳ  ( ϳ̸ 带 )
+		iterator erase(const iterator where) {
+			length--;
+			if (where.node->count > 1) {
+				where.node->count--;
+				return (where.copy < where.node->count) ? where : iterator(std::next(where.node), 0);
+			}
+
+			return iterator(tree.erase(where.node), 0);
+		}
+
+		//   (   )
+		inline int size() const {
+			return length;
+		}
+		//  ٸ   ( )
+		inline int distinct_size() const {
+			return tree.size();
+		}
+		inline bool empty() const {
+			return tree.empty();
+		}
+		void clear() {
+			tree.clear();
+			length = 0;
+		}
+
+	private:
+		static const bool ALLOW_DUPLICATION = false;
+
+		Tree tree;
+		Compare compare;
+		int length;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include "FlatTree.hpp"
+#include "map.hpp"
+
+namespace bon {
+	template <typename K, typename V, class Compare = std::less<K>, class Container = vector<std::pair<K, V>>>
+	class flat_map : public FlatTree<std::pair<K, V>, Compare, select_first<K, V>, Container> {
+	public:
+		using T = std::pair<K, V>;
+		using Tree = FlatTree<T, Compare, select_first<K, V>, Container>;
+
+		using iterator = typename Tree::iterator;
+		using const_iterator = typename Tree::const_iterator;
+
+		flat_map() : Tree() {
+		}
+		flat_map(std::initializer_list<T> initList) : Tree(initList) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		flat_map(const _Iter &first, const _Iter &last) : Tree(first, last) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		flat_map(sorted_unique_t tag, const _Iter &first, const _Iter &last) : Tree(tag, first, last) {
+		}
+		// map ̹ ĵǾ ְ ߺ Ƿ  Ű ⸸  (O(n))
+		template <class Allocator, class Augment, class Balance>
+		explicit flat_map(const map<K, V, Compare, Allocator, Augment, Balance> &source) : Tree() {
+			this->reserve(source.size());
+			this->AppendSorted(source.begin(), source.end());
+		}
+		template <class Allocator, class Augment, class Balance>
+		explicit flat_map(map<K, V, Compare, Allocator, Augment, Balance> &&source) : Tree() {
+			this->reserve(source.size());
+			this->AppendSorted(std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+			source.clear();
+		}
+
+		V &at(const K &key) {
+			iterator iter = this->find(key);
+			if (iter == this->end())
+				throw new std::out_of_range("flat_map::at() called with a missing key");
+			return iter->second;
+		}
+		const V &at(const K &key) const {
+			const_iterator iter = this->find(key);
+			if (iter == this->end())
+				throw new std::out_of_range("flat_map::at() called with a missing key");
+			return iter->second;
+		}
+		//  ⺻  (Ž  ,    Ҹ űǷ O(n))
+		V &operator[](const K &key) {
+			return try_emplace(key).first->second;
+		}
+		V &operator[](K &&key) {
+			return try_emplace(std::move(key)).first->second;
+		}
+
+		// Ű   (key, V(args...))  ,  args  
+		template <class... Args>
+		std::pair<iterator, bool> try_emplace(const K &key, Args &&...args) {
+			return this->EmplaceKey(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+		}
+		template <class... Args>
+		std::pair<iterator, bool> try_emplace(K &&key, Args &&...args) {
+			return this->EmplaceKey(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+		}
+		// Ű  ְ,    ( ̵ Ž  )
+		template <class M>
+		std::pair<iterator, bool> insert_or_assign(const K &key, M &&value) {
+			std::pair<iterator, bool> result = this->EmplaceKey(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<M>(value)));
+			if (!result.second)
+				result.first->second = std::forward<M>(value);
+			return result;
+		}
+		template <class M>
+		std::pair<iterator, bool> insert_or_assign(K &&key, M &&value) {
+			std::pair<iterator, bool> result = this->EmplaceKey(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<M>(value)));
+			if (!result.second)
+				result.first->second = std::forward<M>(value);
+			return result;
+		}
+	};
+}
\ No newline at end of file
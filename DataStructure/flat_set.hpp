@@ -0,0 +1,37 @@
+#pragma once
+
+#include <iterator>
+#include <utility>
+#include "FlatTree.hpp"
+#include "set.hpp"
+
+namespace bon {
+	template <typename T, class Compare = std::less<T>, class Container = vector<T>>
+	class flat_set : public FlatTree<T, Compare, identity_key<T>, Container> {
+	public:
+		using Tree = FlatTree<T, Compare, identity_key<T>, Container>;
+
+		flat_set() : Tree() {
+		}
+		flat_set(std::initializer_list<T> initList) : Tree(initList) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		flat_set(const _Iter &first, const _Iter &last) : Tree(first, last) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		flat_set(sorted_unique_t tag, const _Iter &first, const _Iter &last) : Tree(tag, first, last) {
+		}
+		// set ̹ ĵǾ ְ ߺ Ƿ  Ű ⸸  (O(n))
+		template <class Allocator, class Augment, class Balance>
+		explicit flat_set(const set<T, Compare, Allocator, Augment, Balance> &source) : Tree() {
+			this->reserve(source.size());
+			this->AppendSorted(source.begin(), source.end());
+		}
+		template <class Allocator, class Augment, class Balance>
+		explicit flat_set(set<T, Compare, Allocator, Augment, Balance> &&source) : Tree() {
+			this->reserve(source.size());
+			this->AppendSorted(std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+			source.clear();
+		}
+	};
+}
\ No newline at end of file
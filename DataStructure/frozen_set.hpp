@@ -0,0 +1,288 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "set.hpp"
+#include "tree_traits.hpp"
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
+namespace bon {
+	//   ٲ ʴ  ,  Eytzinger(BFS)  迭 
+	// values[k] ڽ values[2k], values[2k+1]̹Ƿ Ž    ܰ谡  ĳ ο  ־
+	//  ܰ Ʒ ̸ (prefetch) б    
+	// ȸ   ( )
+	template <typename T, class Compare = std::less<T>>
+	class frozen_set {
+	private:
+		static const size_t CACHE_LINE_SIZE = 64;
+		//  ĳ ο   , k ̸ŭ Ʒ ڼյ  ο  
+		static const int PREFETCH_STRIDE = (CACHE_LINE_SIZE / sizeof(T) > 1) ? static_cast<int>(CACHE_LINE_SIZE / sizeof(T)) : 1;
+
+	public:
+		using key_type = T;
+
+		class iterator {
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type		= T;
+			using difference_type	= int;
+			using pointer			= const T *;
+			using reference			= const T &;
+
+			iterator() : values(nullptr), count(0), index(0) {
+			}
+			iterator(const T *values, int count, int index) : values(values), count(count), index(index) {
+			}
+
+			//    ġ (  0)
+			iterator &operator++() {
+				if (2 * index + 1 <= count) {
+					index = 2 * index + 1;
+					while (2 * index <= count)
+						index *= 2;
+				}
+				else {
+					while (index & 1)
+						index >>= 1;
+					index >>= 1;
+				}
+
+				return *this;
+			}
+			const iterator operator++(int) {
+				iterator result(*this);
+				++(*this);
+				return result;
+			}
+
+			bool operator==(const iterator &iter) const {
+				return index == iter.index;
+			}
+			bool operator!=(const iterator &iter) const {
+				return !(*this == iter);
+			}
+
+			const T &operator*() const {
+				return values[index];
+			}
+			const T *operator->() const {
+				return &values[index];
+			}
+
+		private:
+			const T *values;
+			int count;
+			int index; // 0̸ end
+		};
+		using const_iterator = iterator;
+
+	public:
+		frozen_set() : compare(Compare()) {
+			storage = nullptr;
+			values = nullptr;
+			length = 0;
+		}
+		// ĵ  Է ϰ ߺ   ġ
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		frozen_set(const _Iter &first, const _Iter &last) : frozen_set() {
+			std::vector<const T *> sorted;
+			for (auto targetIter = first; targetIter != last; ++targetIter)
+				sorted.push_back(&*targetIter);
+
+			auto lessValue = [this](const T *left, const T *right) {
+				return compare(*left, *right);
+			};
+			std::stable_sort(sorted.begin(), sorted.end(), lessValue);
+			sorted.erase(std::unique(sorted.begin(), sorted.end(), [&](const T *left, const T *right) {
+				return !lessValue(left, right);
+			}), sorted.end());
+
+			Build(sorted);
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		frozen_set(sorted_unique_t, const _Iter &first, const _Iter &last) : frozen_set() {
+			std::vector<const T *> sorted;
+			for (auto targetIter = first; targetIter != last; ++targetIter)
+				sorted.push_back(&*targetIter);
+
+			Build(sorted);
+		}
+		// set ̹ ĵǾ ְ ߺ 
+		template <class Allocator, class Augment, class Balance>
+		explicit frozen_set(const set<T, Compare, Allocator, Augment, Balance> &source) : frozen_set(sorted_unique, source.begin(), source.end()) {
+		}
+		frozen_set(const frozen_set &target) : frozen_set() {
+			Allocate(target.length);
+			for (int i = 1; i <= target.length; i++)
+				ConstructAt(i, target.values[i]);
+		}
+		frozen_set(frozen_set &&target) noexcept : frozen_set() {
+			swap(target);
+		}
+		~frozen_set() {
+			Destroy(length);
+		}
+
+		frozen_set &operator=(frozen_set target) {
+			swap(target);
+			return *this;
+		}
+
+		iterator begin() const {
+			int index = (length > 0) ? 1 : 0;
+			while (2 * index <= length && index > 0)
+				index *= 2;
+			return iterator(values, length, index);
+		}
+		iterator end() const {
+			return iterator(values, length, 0);
+		}
+
+		// AVLTree::lower_bound  ǹ (key ̻ ù ,  end)
+		iterator lower_bound(const key_type &key) const {
+			return iterator(values, length, LowerIndex(key));
+		}
+		iterator upper_bound(const key_type &key) const {
+			return iterator(values, length, UpperIndex(key));
+		}
+		iterator find(const key_type &key) const {
+			int index = LowerIndex(key);
+			if (index == 0 || compare(key, values[index]))
+				return end();
+			return iterator(values, length, index);
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator lower_bound(const Key &key) const {
+			return iterator(values, length, LowerIndex(key));
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator upper_bound(const Key &key) const {
+			return iterator(values, length, UpperIndex(key));
+		}
+		template <class Key, std::enable_if_t<IsTransparent<Compare, Key>::value, int> = 0>
+		iterator find(const Key &key) const {
+			int index = LowerIndex(key);
+			if (index == 0 || compare(key, values[index]))
+				return end();
+			return iterator(values, length, index);
+		}
+		template <class Key>
+		bool contains(const Key &key) const {
+			return find(key) != end();
+		}
+
+		inline int size() const {
+			return length;
+		}
+		inline bool empty() const {
+			return length == 0;
+		}
+
+		void swap(frozen_set &target) noexcept {
+			std::swap(storage, target.storage);
+			std::swap(values, target.values);
+			std::swap(length, target.length);
+			std::swap(compare, target.compare);
+		}
+
+	private:
+		//   (2k) Ǵ (2k+1) ,    尡 
+		template <class Key>
+		int LowerIndex(const Key &key) const {
+			int index = 1;
+			while (index <= length) {
+				Prefetch(index);
+				index = 2 * index + (compare(values[index], key) ? 1 : 0);
+			}
+			return LastLeftTurn(index);
+		}
+		template <class Key>
+		int UpperIndex(const Key &key) const {
+			int index = 1;
+			while (index <= length) {
+				Prefetch(index);
+				index = 2 * index + (compare(key, values[index]) ? 0 : 1);
+			}
+			return LastLeftTurn(index);
+		}
+		//    ܰ(Ʒ 1 Ʈ)   ܰ踦 ǵ
+		static int LastLeftTurn(int index) {
+			while (index & 1)
+				index >>= 1;
+			return index >> 1;
+		}
+		// index PREFETCH_STRIDE ġ  ĳ   ܰ Ʒ ڼյ (迭 ̾ prefetch õ)
+		void Prefetch(int index) const {
+			const char *address = reinterpret_cast<const char *>(reinterpret_cast<uintptr_t>(values) + static_cast<uintptr_t>(index) * PREFETCH_STRIDE * sizeof(T));
+#if defined(_MSC_VER)
+			_mm_prefetch(address, _MM_HINT_T0);
+#else
+			__builtin_prefetch(address);
+#endif
+		}
+
+		// ĵ    Eytzinger ġ Ų  ġ  
+		void Build(const std::vector<const T *> &sorted) {
+			int count = static_cast<int>(sorted.size());
+			std::vector<int> order(count + 1);
+			int next = 0;
+			AssignOrder(order, 1, count, next);
+
+			Allocate(count);
+			for (int i = 1; i <= count; i++)
+				ConstructAt(i, *sorted[order[i]]);
+		}
+		static void AssignOrder(std::vector<int> &order, int index, int count, int &next) {
+			if (index > count)
+				return;
+
+			AssignOrder(order, 2 * index, count, next);
+			order[index] = next++;
+			AssignOrder(order, 2 * index + 1, count, next);
+		}
+
+		// values[0] ĳ  迡   (Ʈ values[1])
+		void Allocate(int count) {
+			storage = static_cast<char *>(::operator new((count + 1) * sizeof(T) + CACHE_LINE_SIZE));
+			uintptr_t address = reinterpret_cast<uintptr_t>(storage);
+			values = reinterpret_cast<T *>((address + CACHE_LINE_SIZE - 1) & ~static_cast<uintptr_t>(CACHE_LINE_SIZE - 1));
+			length = 0;
+		}
+		// 1 ʷ ϸ, ϸ ̹   
+		void ConstructAt(int index, const T &value) {
+			try {
+				new (&values[index]) T(value);
+			}
+			catch (...) {
+				Destroy(index - 1);
+				storage = nullptr;
+				values = nullptr;
+				length = 0;
+				throw;
+			}
+			length = index;
+		}
+		void Destroy(int count) {
+			for (int i = 1; i <= count; i++)
+				values[i].~T();
+			::operator delete(storage);
+		}
+
+	private:
+		char *storage;
+		T *values;
+		int length;
+
+		Compare compare;
+	};
+}
\ No newline at end of file
@@ -1,16 +1,16 @@
 #pragma once
 
+#include <utility>
+
 namespace bon {
 	template <typename T>
 	class list {
 	private:
 		class node {
 		public:
-			node(const T& element)
-				: node(element, nullptr, nullptr) {
-			}
-			node(const T& element, node *prev, node *next)
-				: element(element) {
+			template <class... Args>
+			node(node *prev, node *next, Args &&...args)
+				: element(std::forward<Args>(args)...) {
 				this->prev = prev;
 				this->next = next;
 			}
@@ -97,6 +97,9 @@ namespace bon {
 		list(const list &target) : list() {
 			assign(target.begin(), target.end());
 		}
+		list(list &&target) noexcept : list() {
+			swap(target);
+		}
 		~list() {
 			clear();
 		}
@@ -105,6 +108,13 @@ namespace bon {
 			assign(target.begin(), target.end());
 			return *this;
 		}
+		const list &operator=(list &&target) noexcept {
+			if (this != &target) {
+				clear();
+				swap(target);
+			}
+			return *this;
+		}
 
 		const T &front() const {
 			if (empty())
@@ -128,30 +138,46 @@ namespace bon {
 		}
 
 		void push_front(const T &value) {
+			emplace_front(value);
+		}
+		void push_front(T &&value) {
+			emplace_front(std::move(value));
+		}
+		void push_back(const T &value) {
+			emplace_back(value);
+		}
+		void push_back(T &&value) {
+			emplace_back(std::move(value));
+		}
+		template <class... Args>
+		T &emplace_front(Args &&...args) {
 			if (empty()) {
-				node *newNode = new node(value);
+				node *newNode = new node(nullptr, nullptr, std::forward<Args>(args)...);
 				head = tail = newNode;
 			}
 			else {
-				node *newNode = new node(value, nullptr, head);
+				node *newNode = new node(nullptr, head, std::forward<Args>(args)...);
 				head->prev = newNode;
 				head = newNode;
 			}
 
 			length++;
+			return head->element;
 		}
-		void push_back(const T &value) {
+		template <class... Args>
+		T &emplace_back(Args &&...args) {
 			if (empty()) {
-				node *newNode = new node(value);
+				node *newNode = new node(nullptr, nullptr, std::forward<Args>(args)...);
 				head = tail = newNode;
 			}
 			else {
-				node *newNode = new node(value, tail, nullptr);
+				node *newNode = new node(tail, nullptr, std::forward<Args>(args)...);
 				tail->next = newNode;
 				tail = newNode;
 			}
 
 			length++;
+			return tail->element;
 		}
 		void pop_front() {
 			if (empty())
@@ -213,7 +239,14 @@ namespace bon {
 		}
 
 		iterator insert(const iterator &where, const T &value) {
-			node *newNode = new node(value, where.prev, where.curr);
+			return emplace(where, value);
+		}
+		iterator insert(const iterator &where, T &&value) {
+			return emplace(where, std::move(value));
+		}
+		template <class... Args>
+		iterator emplace(const iterator &where, Args &&...args) {
+			node *newNode = new node(where.prev, where.curr, std::forward<Args>(args)...);
 			node *nextNode = where.curr;
 			iterator nextIter;
 
@@ -291,6 +324,11 @@ namespace bon {
 		void clear() {
 			erase(begin(), end());
 		}
+		void swap(list &target) noexcept {
+			std::swap(head, target.head);
+			std::swap(tail, target.tail);
+			std::swap(length, target.length);
+		}
 
 	private:
 		node *head, *tail;
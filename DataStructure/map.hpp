@@ -1,26 +1,35 @@
 #pragma once
 
+#include <stdexcept>
+#include <tuple>
 #include <utility>
 #include "AVLTree.hpp"
+#include "CompactTree.hpp"
 
 namespace bon {
+	//  map ⺻ :  map Compare Ű ϹǷ std::less<K> 
+	// ״ Ѱܵ ϵ Ű 񱳵 
 	template <typename K, typename V>
-	class lessPair {
+	class [[deprecated("bon::map now compares keys; use std::less<K> instead of lessPair")]] lessPair {
 	public:
 		using T = std::pair<K, V>;
 
-		bool operator()(const T& left, const T& right) const {
+		bool operator()(const T &left, const T &right) const {
 			return left.first < right.first;
 		}
+		bool operator()(const K &left, const K &right) const {
+			return left < right;
+		}
 	};
 
-	template <typename K, typename V, class Compare = lessPair<K, V>>
-	class map : public AVLTree<std::pair<K, V>, Compare> {
+	template <typename K, typename V, class Compare = std::less<K>, class Allocator = pool_allocator<std::pair<K, V>>, class Augment = no_augment, class Balance = avl_balance>
+	class map : public AVLTree<std::pair<K, V>, Compare, Allocator, select_first<K, V>, Augment, Balance> {
 	public:
 		using T = std::pair<K, V>;
-		using Tree = AVLTree<T, Compare>;
+		using Tree = AVLTree<T, Compare, Allocator, select_first<K, V>, Augment, Balance>;
+		static_assert(IsKeyCompare<Compare, K>::value, "bon::map's Compare is called with two keys (const K &), not with std::pair<K, V>");
 
-		using iterator = Tree::iterator;
+		using iterator = typename Tree::iterator;
 
 		map() : Tree(ALLOW_DUPLICATION) {
 		}
@@ -29,37 +38,78 @@ namespace bon {
 		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
 		map(const _Iter &first, const _Iter &last) : Tree(first, last, ALLOW_DUPLICATION) {
 		}
-		map(const map &tree) : Tree(tree.begin(), tree.end(), ALLOW_DUPLICATION) {
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		map(parallel_t policy, const _Iter &first, const _Iter &last) : Tree(policy, first, last, ALLOW_DUPLICATION) {
 		}
-
-		iterator find(const K &value) const {
-			return Tree::find(std::make_pair(value, V()));
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		map(sorted_unique_t tag, const _Iter &first, const _Iter &last) : Tree(tag, first, last, ALLOW_DUPLICATION) {
 		}
-		iterator lower_bound(const K &value) const {
-			return Tree::lower_bound(std::make_pair(value, V()));
+		map(const map &tree) : Tree(tree) {
 		}
-		iterator upper_bound(const K &value) const {
-			return Tree::upper_bound(std::make_pair(value, V()));
+		map(map &&tree) noexcept : Tree(std::move(tree)) {
 		}
 
-		void erase(const K &value) {
-			erase(find(value));
+		map &operator=(const map &tree) {
+			Tree::operator=(tree);
+			return *this;
 		}
-		iterator erase(const iterator where) {
-			return Tree::erase(where);
+		map &operator=(map &&tree) {
+			Tree::operator=(std::move(tree));
+			return *this;
 		}
-		iterator erase(const iterator &first, const iterator &last) {
-			return Tree::erase(first, last);
+
+		using Tree::split;
+		// key ̻ Ҹ   map ȯ
+		map split(const K &key) {
+			map right;
+			Tree::split(key, right);
+			return right;
 		}
 
-		const V &at(const K &key) const {
-			iterator iter = find(key);
+		V &at(const K &key) {
+			iterator iter = this->find(key);
+			if (iter == this->end())
+				throw new std::out_of_range("map::at() called with a missing key");
 			return iter->second;
 		}
-		V &operator[](const K &key) const {
-			iterator iter = find(key);
+		const V &at(const K &key) const {
+			iterator iter = this->find(key);
+			if (iter == this->end())
+				throw new std::out_of_range("map::at() called with a missing key");
 			return iter->second;
 		}
+		//  ⺻  (Ž  )
+		V &operator[](const K &key) {
+			return try_emplace(key).first->second;
+		}
+		V &operator[](K &&key) {
+			return try_emplace(std::move(key)).first->second;
+		}
+
+		// Ű   ã ڸ (key, V(args...)) ٷ  ,  args  
+		template <class... Args>
+		std::pair<iterator, bool> try_emplace(const K &key, Args &&...args) {
+			return this->EmplaceKey(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+		}
+		template <class... Args>
+		std::pair<iterator, bool> try_emplace(K &&key, Args &&...args) {
+			return this->EmplaceKey(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+		}
+		// Ű  ְ,    ( ̵ Ž  )
+		template <class M>
+		std::pair<iterator, bool> insert_or_assign(const K &key, M &&value) {
+			std::pair<iterator, bool> result = this->EmplaceKey(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<M>(value)));
+			if (!result.second)
+				result.first->second = std::forward<M>(value);
+			return result;
+		}
+		template <class M>
+		std::pair<iterator, bool> insert_or_assign(K &&key, M &&value) {
+			std::pair<iterator, bool> result = this->EmplaceKey(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<M>(value)));
+			if (!result.second)
+				result.first->second = std::forward<M>(value);
+			return result;
+		}
 
 	private:
 		static const bool ALLOW_DUPLICATION = false;
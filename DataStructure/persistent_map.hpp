@@ -0,0 +1,457 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "tree_traits.hpp"
+
+namespace bon {
+	//  (path copying)   AVL 
+	// / Ʈ  O(log n) 常      
+	// snapshot() Ʈ ϹǷ O(1)̸,   Ƚ 0 Ǹ 
+	// 忡 θ Ͱ   ϹǷ AVLTree    /ȸ Ģ Һ 带 
+	//  带  ʺ    Ƿ Ҵڴ 纻  带   ־  (std::allocator )
+	template <typename K, typename V, class Compare = std::less<K>, class Allocator = std::allocator<std::pair<K, V>>>
+	class persistent_map {
+	public:
+		using T = std::pair<K, V>;
+		using key_type = K;
+
+	private:
+		class node {
+		public:
+			template <class... Args>
+			node(node *left, node *right, Args &&...args) : value(std::forward<Args>(args)...) {
+				this->left = left;
+				this->right = right;
+				this->refCount = 1;
+
+				int leftHeight = HeightOf(left), rightHeight = HeightOf(right);
+				this->height = (leftHeight > rightHeight) ? leftHeight+1 : rightHeight+1;
+			}
+
+			//     ٲ  (  )
+			const T value;
+			node *left, *right;
+			int height;
+			std::atomic<int> refCount; //  带 Ű θ Ʈ 
+		};
+
+		using NodeAllocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+		using NodeTraits	= std::allocator_traits<NodeAllocator>;
+
+		//   1  AVL Ʈ ִ  (int    )
+		static const int MAX_HEIGHT = 48;
+
+	public:
+		// θ Ͱ Ƿ Ʈ θ  ٴϴ  ݺ
+		// ݺڸ  ()  ִ  ȿϸ,   ϰ    ȸ
+		class const_iterator {
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type		= T;
+			using difference_type	= int;
+			using pointer			= const T *;
+			using reference			= const T &;
+
+			const_iterator() : depth(0) {
+			}
+
+			const_iterator &operator++() {
+				const node *curr = path[--depth];
+				PushLeftPath(curr->right);
+				return *this;
+			}
+			const const_iterator operator++(int) {
+				const_iterator result(*this);
+				++(*this);
+				return result;
+			}
+
+			bool operator==(const const_iterator &iter) const {
+				if (depth == 0 || iter.depth == 0)
+					return depth == iter.depth;
+				return path[depth-1] == iter.path[iter.depth-1];
+			}
+			bool operator!=(const const_iterator &iter) const {
+				return !(*this == iter);
+			}
+
+			const T &operator*() const {
+				return path[depth-1]->value;
+			}
+			const T *operator->() const {
+				return &path[depth-1]->value;
+			}
+
+		private:
+			void PushLeftPath(const node *curr) {
+				for (; curr != nullptr; curr = curr->left)
+					path[depth++] = curr;
+			}
+
+			// path[depth-1]  ̰,  Ʒ  湮   ( 尡  Ʈ ִ )
+			const node *path[MAX_HEIGHT];
+			int depth;
+
+			friend class persistent_map;
+		};
+		using iterator = const_iterator;
+
+	public:
+		persistent_map(const Allocator &allocator = Allocator()) : nodeAllocator(allocator) {
+			root = nullptr;
+			length = 0;
+		}
+		persistent_map(std::initializer_list<T> initList, const Allocator &allocator = Allocator()) : persistent_map(allocator) {
+			for (const T &value : initList)
+				insert(value);
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		persistent_map(const _Iter &first, const _Iter &last, const Allocator &allocator = Allocator()) : persistent_map(allocator) {
+			for (_Iter iter = first; iter != last; ++iter)
+				insert(*iter);
+		}
+		// Ʈ  (O(1))
+		persistent_map(const persistent_map &right) : compare(right.compare), nodeAllocator(right.nodeAllocator) {
+			root = Acquire(right.root);
+			length = right.length;
+		}
+		persistent_map(persistent_map &&right) noexcept : compare(right.compare), nodeAllocator(right.nodeAllocator) {
+			root = right.root;
+			length = right.length;
+
+			right.root = nullptr;
+			right.length = 0;
+		}
+		~persistent_map() {
+			Release(root);
+		}
+
+		persistent_map &operator=(const persistent_map &right) {
+			if (this != &right) {
+				node *oldRoot = root;
+
+				root = Acquire(right.root);
+				length = right.length;
+				Release(oldRoot);
+			}
+
+			return *this;
+		}
+		persistent_map &operator=(persistent_map &&right) noexcept {
+			if (this != &right) {
+				Release(root);
+
+				root = right.root;
+				length = right.length;
+
+				right.root = nullptr;
+				right.length = 0;
+			}
+
+			return *this;
+		}
+
+		//   б   (   ص ٲ )
+		persistent_map snapshot() const {
+			return persistent_map(*this);
+		}
+
+		// Ű ̹  ƹ͵ ٲ ʰ false ȯ
+		bool insert(const T &value) {
+			return Update(value, false);
+		}
+		// Ű ̹   ü (  true)
+		bool insert_or_assign(const K &key, const V &value) {
+			return Update(T(key, value), true);
+		}
+		//    ȯ
+		int erase(const K &key) {
+			bool bErased = false;
+			node *newRoot = Erase(root, key, bErased);
+			if (!bErased) {
+				Release(newRoot);
+				return 0;
+			}
+
+			Release(root);
+			root = newRoot;
+			length--;
+			return 1;
+		}
+		void clear() {
+			Release(root);
+			root = nullptr;
+			length = 0;
+		}
+
+		const_iterator find(const K &key) const {
+			const_iterator result = lower_bound(key);
+			if (result != end() && compare(key, result->first))
+				return end();
+			return result;
+		}
+		const_iterator lower_bound(const K &key) const {
+			const_iterator result;
+			for (const node *curr = root; curr != nullptr; ) {
+				if (compare(curr->value.first, key))
+					curr = curr->right;
+				else {
+					result.path[result.depth++] = curr;
+					curr = curr->left;
+				}
+			}
+			return result;
+		}
+		const_iterator upper_bound(const K &key) const {
+			const_iterator result;
+			for (const node *curr = root; curr != nullptr; ) {
+				if (compare(key, curr->value.first)) {
+					result.path[result.depth++] = curr;
+					curr = curr->left;
+				}
+				else
+					curr = curr->right;
+			}
+			return result;
+		}
+		// ݺ θ  ʰ Ž 
+		bool contains(const K &key) const {
+			const node *candidate = nullptr;
+			for (const node *curr = root; curr != nullptr; ) {
+				if (compare(curr->value.first, key))
+					curr = curr->right;
+				else {
+					candidate = curr;
+					curr = curr->left;
+				}
+			}
+			return candidate != nullptr && !compare(key, candidate->value.first);
+		}
+		int count(const K &key) const {
+			return contains(key) ? 1 : 0;
+		}
+
+		const V &at(const K &key) const {
+			const_iterator iter = find(key);
+			if (iter == end())
+				throw new std::out_of_range("persistent_map::at");
+			return iter->second;
+		}
+
+		const_iterator begin() const {
+			const_iterator result;
+			result.PushLeftPath(root);
+			return result;
+		}
+		const_iterator end() const {
+			return const_iterator();
+		}
+
+		inline int size() const {
+			return length;
+		}
+		inline bool empty() const {
+			return root == nullptr;
+		}
+
+	private:
+		static int HeightOf(const node *target) {
+			return (target != nullptr) ? target->height : 0;
+		}
+
+		static node *Acquire(node *target) {
+			if (target != nullptr)
+				target->refCount.fetch_add(1, std::memory_order_relaxed);
+			return target;
+		}
+		//    带 ϰ ڽ  
+		void Release(node *target) {
+			while (target != nullptr && target->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				node *left = target->left, *right = target->right;
+
+				NodeTraits::destroy(nodeAllocator, target);
+				NodeTraits::deallocate(nodeAllocator, target, 1);
+
+				Release(left);
+				target = right;
+			}
+		}
+
+		// left, right ڽ ϴ  带  (ϸ  尡 ڽ  )
+		template <class... Args>
+		node *CreateNode(node *left, node *right, Args &&...args) {
+			node *newNode = NodeTraits::allocate(nodeAllocator, 1);
+			try {
+				NodeTraits::construct(nodeAllocator, newNode, left, right, std::forward<Args>(args)...);
+			}
+			catch (...) {
+				NodeTraits::deallocate(nodeAllocator, newNode, 1);
+				throw;
+			}
+
+			Acquire(left);
+			Acquire(right);
+			return newNode;
+		}
+
+		// left, right  Ѱܹ޾ value    հ,   2 Ǹ ȸ (ȸǴ ڽĵ  )
+		// ܰ  Ѱܹ  
+		node *Balance(const T &value, node *left, node *right) {
+			node *rotated = nullptr, *result = nullptr;
+
+			try {
+				int diff = HeightOf(left) - HeightOf(right);
+
+				if (diff > 1) {
+					if (HeightOf(left->left) >= HeightOf(left->right)) {
+						// LL: left  Ʈ
+						rotated = CreateNode(left->right, right, value);
+						result = CreateNode(left->left, rotated, left->value);
+					}
+					else {
+						// LR: left->right  Ʈ
+						node *pivot = left->right;
+						rotated = CreateNode(left->left, pivot->left, left->value);
+						node *newRight = CreateNode(pivot->right, right, value);
+						try {
+							result = CreateNode(rotated, newRight, pivot->value);
+						}
+						catch (...) {
+							Release(newRight);
+							throw;
+						}
+						Release(newRight);
+					}
+				}
+				else if (diff < -1) {
+					if (HeightOf(right->right) >= HeightOf(right->left)) {
+						// RR: right  Ʈ
+						rotated = CreateNode(left, right->left, value);
+						result = CreateNode(rotated, right->right, right->value);
+					}
+					else {
+						// RL: right->left  Ʈ
+						node *pivot = right->left;
+						rotated = CreateNode(pivot->right, right->right, right->value);
+						node *newLeft = CreateNode(left, pivot->left, value);
+						try {
+							result = CreateNode(newLeft, rotated, pivot->value);
+						}
+						catch (...) {
+							Release(newLeft);
+							throw;
+						}
+						Release(newLeft);
+					}
+				}
+				else
+					result = CreateNode(left, right, value);
+			}
+			catch (...) {
+				Release(rotated);
+				Release(left);
+				Release(right);
+				throw;
+			}
+
+			Release(rotated);
+			Release(left);
+			Release(right);
+			return result;
+		}
+
+		bool Update(const T &value, bool bAssign) {
+			bool bInserted = false;
+			node *newRoot = Insert(root, value, bAssign, bInserted);
+			if (newRoot == root) {
+				Release(newRoot);
+				return false;
+			}
+
+			Release(root);
+			root = newRoot;
+			if (bInserted)
+				length++;
+			return bInserted;
+		}
+		// target  Ʈ  ȯ (ٲ   target ڽ)
+		node *Insert(node *target, const T &value, bool bAssign, bool &bInserted) {
+			if (target == nullptr) {
+				bInserted = true;
+				return CreateNode(nullptr, nullptr, value);
+			}
+
+			if (compare(value.first, target->value.first)) {
+				node *newLeft = Insert(target->left, value, bAssign, bInserted);
+				if (newLeft == target->left)
+					return Unchanged(target, newLeft);
+				return Balance(target->value, newLeft, Acquire(target->right));
+			}
+			if (compare(target->value.first, value.first)) {
+				node *newRight = Insert(target->right, value, bAssign, bInserted);
+				if (newRight == target->right)
+					return Unchanged(target, newRight);
+				return Balance(target->value, Acquire(target->left), newRight);
+			}
+
+			if (!bAssign)
+				return Acquire(target);
+			return CreateNode(target->left, target->right, value);
+		}
+		node *Unchanged(node *target, node *child) {
+			Release(child);
+			return Acquire(target);
+		}
+
+		node *Erase(node *target, const K &key, bool &bErased) {
+			if (target == nullptr)
+				return nullptr;
+
+			if (compare(key, target->value.first)) {
+				node *newLeft = Erase(target->left, key, bErased);
+				if (!bErased)
+					return Unchanged(target, newLeft);
+				return Balance(target->value, newLeft, Acquire(target->right));
+			}
+			if (compare(target->value.first, key)) {
+				node *newRight = Erase(target->right, key, bErased);
+				if (!bErased)
+					return Unchanged(target, newRight);
+				return Balance(target->value, Acquire(target->left), newRight);
+			}
+
+			bErased = true;
+			if (target->left == nullptr)
+				return Acquire(target->right);
+			if (target->right == nullptr)
+				return Acquire(target->left);
+
+			//  Ʈ ּ ҷ ü
+			const node *successor = nullptr;
+			node *newRight = EraseMin(target->right, successor);
+			return Balance(successor->value, Acquire(target->left), newRight);
+		}
+		// ּ 带  Ʈ ȯ (ּ   Ʈ  ϹǷ ȿ)
+		node *EraseMin(node *target, const node *&minNode) {
+			if (target->left == nullptr) {
+				minNode = target;
+				return Acquire(target->right);
+			}
+
+			node *newLeft = EraseMin(target->left, minNode);
+			return Balance(target->value, newLeft, Acquire(target->right));
+		}
+
+	private:
+		node *root;
+		int length;
+
+		Compare compare;
+		NodeAllocator nodeAllocator;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace bon {
+	template <typename T, size_t ChunkSize = 256>
+	class pool_allocator {
+	private:
+		union slot {
+			slot *next;
+			alignas(T) unsigned char storage[sizeof(T)];
+		};
+		struct chunk {
+			chunk *next;
+			slot slots[ChunkSize];
+		};
+		// ûũ :  Ǯ ûũ ߰ϰ, ҷ 带 Ѱܹ Ǯ  ÷  Բ 
+		//     ûũ ȯ
+		struct chunk_group {
+			chunk *chunks;
+			chunk *last; //    ûũ ( )
+			std::atomic<int> references;
+		};
+
+	public:
+		using value_type		= T;
+		using size_type			= size_t;
+		using difference_type	= ptrdiff_t;
+
+		using propagate_on_container_copy_assignment	= std::false_type;
+		using propagate_on_container_move_assignment	= std::true_type;
+		using propagate_on_container_swap				= std::true_type;
+		using is_always_equal							= std::false_type;
+
+		template <typename U>
+		struct rebind {
+			using other = pool_allocator<U, ChunkSize>;
+		};
+
+		pool_allocator() noexcept : own(nullptr), freeList(nullptr), freeTail(nullptr) {
+		}
+		// Ǯ ̳ʸ  Ƿ 纻  Ǯ 
+		pool_allocator(const pool_allocator &) noexcept : pool_allocator() {
+		}
+		template <typename U>
+		pool_allocator(const pool_allocator<U, ChunkSize> &) noexcept : pool_allocator() {
+		}
+		pool_allocator(pool_allocator &&target) noexcept : own(target.own), shared(std::move(target.shared)), freeList(target.freeList), freeTail(target.freeTail) {
+			target.own = nullptr;
+			target.shared.clear();
+			target.freeList = nullptr;
+			target.freeTail = nullptr;
+		}
+		~pool_allocator() {
+			release();
+		}
+
+		pool_allocator &operator=(const pool_allocator &) noexcept {
+			return *this;
+		}
+		pool_allocator &operator=(pool_allocator &&target) noexcept {
+			if (this != &target) {
+				release();
+				own = target.own;
+				shared = std::move(target.shared);
+				freeList = target.freeList;
+				freeTail = target.freeTail;
+				target.own = nullptr;
+				target.shared.clear();
+				target.freeList = nullptr;
+				target.freeTail = nullptr;
+			}
+			return *this;
+		}
+
+		T *allocate(size_t count) {
+			if (count != 1)
+				return static_cast<T *>(::operator new(count * sizeof(T)));
+
+			if (freeList == nullptr)
+				grow();
+
+			slot *target = freeList;
+			freeList = target->next;
+			if (freeList == nullptr)
+				freeTail = nullptr;
+			return reinterpret_cast<T *>(target);
+		}
+		void deallocate(T *ptr, size_t count) noexcept {
+			if (count != 1) {
+				::operator delete(ptr);
+				return;
+			}
+
+			slot *target = reinterpret_cast<slot *>(ptr);
+			if (freeList == nullptr)
+				freeTail = target;
+			target->next = freeList;
+			freeList = target;
+		}
+
+		// Ҵ  ûũ   ȯ (ִ ü ȣ  ҸѾ )
+		// ٸ Ǯ   ûũ  Ǯ    
+		void release() noexcept {
+			if (own != nullptr)
+				Drop(own);
+			for (chunk_group *group : shared)
+				Drop(group);
+
+			own = nullptr;
+			shared.clear();
+			freeList = nullptr;
+			freeTail = nullptr;
+		}
+		// source Ҵ 带  Ǯ    ֵ source ûũ  Բ 
+		// source 尡     ()
+		void share(const pool_allocator &source) {
+			if (this == &source)
+				return;
+
+			if (source.own != nullptr)
+				Acquire(source.own);
+			for (chunk_group *group : source.shared)
+				Acquire(group);
+		}
+		// source ûũ    Ѱܹް source  Ǯ 
+		// source 带  Ѱܹ   (ġ): ûũ ϰ    ̾ ̹Ƿ  ð
+		void splice(pool_allocator &source) {
+			if (this == &source)
+				return;
+
+			//  Ǯ̸ ״ Ѱܹ (Ҵ )
+			if (own == nullptr && shared.empty()) {
+				*this = std::move(source);
+				return;
+			}
+
+			// Ʒ ܰ  ʵ Ѱܹ  ڸ  Ȯ
+			shared.reserve(shared.size() + source.shared.size() + 1);
+
+			if (source.own != nullptr) {
+				if (own == nullptr)
+					own = source.own;
+				else if (source.own->references == 1) {
+					// ٸ Ǯ   ̸ ûũ  Ǯ  ħ
+					if (source.own->chunks != nullptr) {
+						source.own->last->next = own->chunks;
+						if (own->chunks == nullptr)
+							own->last = source.own->last;
+						own->chunks = source.own->chunks;
+					}
+					delete source.own;
+				}
+				else
+					Adopt(source.own);
+			}
+			for (chunk_group *group : source.shared)
+				Adopt(group);
+
+			if (source.freeList != nullptr) {
+				source.freeTail->next = freeList;
+				if (freeList == nullptr)
+					freeTail = source.freeTail;
+				freeList = source.freeList;
+			}
+
+			source.own = nullptr;
+			source.shared.clear();
+			source.freeList = nullptr;
+			source.freeTail = nullptr;
+		}
+		//  Ǯ  ûũ   (ٸ Ǯ   ûũ )
+		size_t capacity() const noexcept {
+			size_t count = Capacity(own);
+			for (chunk_group *group : shared)
+				count += Capacity(group);
+			return count;
+		}
+
+		bool operator==(const pool_allocator &target) const noexcept {
+			return this == &target;
+		}
+		bool operator!=(const pool_allocator &target) const noexcept {
+			return !(*this == target);
+		}
+
+	private:
+		void grow() {
+			if (own == nullptr)
+				own = new chunk_group{ nullptr, nullptr, { 1 } };
+
+			chunk *newChunk = static_cast<chunk *>(::operator new(sizeof(chunk)));
+			newChunk->next = own->chunks;
+			if (own->chunks == nullptr)
+				own->last = newChunk;
+			own->chunks = newChunk;
+			freeTail = &newChunk->slots[ChunkSize - 1];
+
+			// ûũ  Ժ   
+			for (size_t i = ChunkSize; i-- > 0; ) {
+				newChunk->slots[i].next = freeList;
+				freeList = &newChunk->slots[i];
+			}
+		}
+		void Acquire(chunk_group *group) {
+			if (group == own || std::find(shared.begin(), shared.end(), group) != shared.end())
+				return;
+
+			shared.push_back(group);
+			group->references++;
+		}
+		// ٸ Ǯ   ״ Ѱܹ (̹  ̸ Ѱܹ  )
+		void Adopt(chunk_group *group) {
+			if (group == own || std::find(shared.begin(), shared.end(), group) != shared.end()) {
+				Drop(group);
+				return;
+			}
+
+			shared.push_back(group);
+		}
+		static void Drop(chunk_group *group) noexcept {
+			if (--group->references > 0)
+				return;
+
+			while (group->chunks != nullptr) {
+				chunk *target = group->chunks;
+				group->chunks = target->next;
+				::operator delete(target);
+			}
+			delete group;
+		}
+		static size_t Capacity(const chunk_group *group) noexcept {
+			size_t count = 0;
+			if (group != nullptr) {
+				for (const chunk *curr = group->chunks; curr != nullptr; curr = curr->next)
+					count += ChunkSize;
+			}
+			return count;
+		}
+
+	private:
+		chunk_group *own; //  Ǯ ûũ ߰ϴ  (ó Ҵ  )
+		std::vector<chunk_group *> shared; // ٸ ǮԼ Ѱܹ 尡 ִ 
+		slot *freeList;
+		slot *freeTail; //     (ٸ Ǯ  ̾   )
+	};
+}
\ No newline at end of file
@@ -1,11 +1,14 @@
 #pragma once
 
-#include "list.hpp"
+#include <utility>
+#include "ring_buffer.hpp"
 
 namespace bon {
-	template <typename T>
+	template <typename T, class Container = ring_buffer<T>>
 	class queue {
 	public:
+		using container_type = Container;
+
 		const T &front() {
 			return container.front();
 		}
@@ -16,6 +19,13 @@ namespace bon {
 		void push(const T& value) {
 			container.push_back(value);
 		}
+		void push(T &&value) {
+			container.push_back(std::move(value));
+		}
+		template <class... Args>
+		void emplace(Args &&...args) {
+			container.emplace_back(std::forward<Args>(args)...);
+		}
 		void pop() {
 			container.pop_front();
 		}
@@ -28,7 +38,7 @@ namespace bon {
 		}
 
 	private:
-		list<T> container;
+		Container container;
 	};
 }
 
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace bon {
+	template <typename T>
+	class ring_buffer {
+	public:
+		ring_buffer() : buffer(nullptr), capacity(0), head(0), length(0) {
+		}
+		ring_buffer(const ring_buffer &target) : ring_buffer() {
+			reserve(target.length);
+			for (int i = 0; i < target.length; i++)
+				push_back(target[i]);
+		}
+		ring_buffer(ring_buffer &&target) noexcept : ring_buffer() {
+			swap(target);
+		}
+		~ring_buffer() {
+			clear();
+			::operator delete(buffer);
+		}
+
+		const ring_buffer &operator=(const ring_buffer &target) {
+			if (this != &target) {
+				ring_buffer temp(target);
+				swap(temp);
+			}
+			return *this;
+		}
+		const ring_buffer &operator=(ring_buffer &&target) noexcept {
+			if (this != &target) {
+				clear();
+				swap(target);
+			}
+			return *this;
+		}
+
+		T &operator[](int index) {
+			return buffer[(head + index) & (capacity - 1)];
+		}
+		const T &operator[](int index) const {
+			return buffer[(head + index) & (capacity - 1)];
+		}
+
+		T &front() {
+			if (empty())
+				throw new std::runtime_error("front() called on empty ring_buffer");
+			return buffer[head];
+		}
+		const T &front() const {
+			if (empty())
+				throw new std::runtime_error("front() called on empty ring_buffer");
+			return buffer[head];
+		}
+		T &back() {
+			if (empty())
+				throw new std::runtime_error("back() called on empty ring_buffer");
+			return (*this)[length - 1];
+		}
+		const T &back() const {
+			if (empty())
+				throw new std::runtime_error("back() called on empty ring_buffer");
+			return (*this)[length - 1];
+		}
+
+		void push_back(const T &value) {
+			emplace_back(value);
+		}
+		void push_back(T &&value) {
+			emplace_back(std::move(value));
+		}
+		template <class... Args>
+		T &emplace_back(Args &&...args) {
+			if (length == capacity) {
+				// ڰ   Ҹ ų  Ƿ    Ȯ
+				T value(std::forward<Args>(args)...);
+				grow(capacity != 0 ? capacity * 2 : INITIAL_CAPACITY);
+				return construct((head + length) & (capacity - 1), std::move(value));
+			}
+
+			return construct((head + length) & (capacity - 1), std::forward<Args>(args)...);
+		}
+		void push_front(const T &value) {
+			emplace_front(value);
+		}
+		void push_front(T &&value) {
+			emplace_front(std::move(value));
+		}
+		template <class... Args>
+		T &emplace_front(Args &&...args) {
+			if (length == capacity) {
+				T value(std::forward<Args>(args)...);
+				grow(capacity != 0 ? capacity * 2 : INITIAL_CAPACITY);
+				head = (head - 1) & (capacity - 1);
+				return construct(head, std::move(value));
+			}
+
+			head = (head - 1) & (capacity - 1);
+			return construct(head, std::forward<Args>(args)...);
+		}
+		void pop_front() {
+			if (empty())
+				throw new std::runtime_error("pop_front() called on empty ring_buffer");
+
+			buffer[head].~T();
+			head = (head + 1) & (capacity - 1);
+			length--;
+		}
+		void pop_back() {
+			if (empty())
+				throw new std::runtime_error("pop_back() called on empty ring_buffer");
+
+			(*this)[length - 1].~T();
+			length--;
+		}
+
+		// 뷮 ׻ 2 ŵ  (ε  Ʈ ũ ó)
+		void reserve(int count) {
+			if (count <= capacity)
+				return;
+
+			int newCapacity = (capacity != 0) ? capacity : INITIAL_CAPACITY;
+			while (newCapacity < count)
+				newCapacity *= 2;
+			grow(newCapacity);
+		}
+
+		inline int size() const {
+			return length;
+		}
+		inline bool empty() const {
+			return length == 0;
+		}
+		void clear() {
+			for (int i = 0; i < length; i++)
+				(*this)[i].~T();
+			head = 0;
+			length = 0;
+		}
+		void swap(ring_buffer &target) noexcept {
+			std::swap(buffer, target.buffer);
+			std::swap(capacity, target.capacity);
+			std::swap(head, target.head);
+			std::swap(length, target.length);
+		}
+
+	private:
+		template <class... Args>
+		T &construct(int index, Args &&...args) {
+			T *target = &buffer[index];
+			new (target) T(std::forward<Args>(args)...);
+			length++;
+			return *target;
+		}
+		void grow(int newCapacity) {
+			T *newBuffer = static_cast<T *>(::operator new(newCapacity * sizeof(T)));
+
+			// Ҹ   ʺ   ű ڿ  Ҹ Ҹ (  ܰ   ۴ ״)
+			int built = 0;
+			try {
+				for (; built < length; built++)
+					new (&newBuffer[built]) T(std::move_if_noexcept((*this)[built]));
+			}
+			catch (...) {
+				for (int i = 0; i < built; i++)
+					newBuffer[i].~T();
+				::operator delete(newBuffer);
+				throw;
+			}
+
+			for (int i = 0; i < length; i++)
+				(*this)[i].~T();
+			::operator delete(buffer);
+			buffer = newBuffer;
+			capacity = newCapacity;
+			head = 0;
+		}
+
+	private:
+		static const int INITIAL_CAPACITY = 16;
+
+		T *buffer;
+		int capacity;
+		int head;
+		int length;
+	};
+}
\ No newline at end of file
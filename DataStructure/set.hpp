@@ -1,12 +1,14 @@
 #pragma once
 
+#include <utility>
 #include "AVLTree.hpp"
+#include "CompactTree.hpp"
 
 namespace bon {
-	template <typename T, class Compare = std::less<T>>
-	class set : public AVLTree<T, Compare> {
+	template <typename T, class Compare = std::less<T>, class Allocator = pool_allocator<T>, class Augment = no_augment, class Balance = avl_balance>
+	class set : public AVLTree<T, Compare, Allocator, identity_key<T>, Augment, Balance> {
 	public:
-		using Tree = AVLTree<T, Compare>;
+		using Tree = AVLTree<T, Compare, Allocator, identity_key<T>, Augment, Balance>;
 
 		set() : Tree(ALLOW_DUPLICATION) {
 		}
@@ -15,7 +17,32 @@ namespace bon {
 		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
 		set(const _Iter &first, const _Iter &last) : Tree(first, last, ALLOW_DUPLICATION) {
 		}
-		set(const set &right) : Tree(right.begin(), right.end(), ALLOW_DUPLICATION) {
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		set(parallel_t policy, const _Iter &first, const _Iter &last) : Tree(policy, first, last, ALLOW_DUPLICATION) {
+		}
+		template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, int> = 0>
+		set(sorted_unique_t tag, const _Iter &first, const _Iter &last) : Tree(tag, first, last, ALLOW_DUPLICATION) {
+		}
+		set(const set &right) : Tree(right) {
+		}
+		set(set &&right) noexcept : Tree(std::move(right)) {
+		}
+
+		set &operator=(const set &right) {
+			Tree::operator=(right);
+			return *this;
+		}
+		set &operator=(set &&right) {
+			Tree::operator=(std::move(right));
+			return *this;
+		}
+
+		using Tree::split;
+		// key ̻ Ҹ   set ȯ
+		set split(const T &key) {
+			set right;
+			Tree::split(key, right);
+			return right;
 		}
 
 	private:
@@ -1,11 +1,14 @@
 #pragma once
 
-#include "list.hpp"
+#include <utility>
+#include "vector.hpp"
 
 namespace bon {
-	template <typename T>
+	template <typename T, class Container = vector<T>>
 	class stack {
 	public:
+		using container_type = Container;
+
 		const T &top() {
 			return container.back();
 		}
@@ -13,6 +16,13 @@ namespace bon {
 		void push(const T &value) {
 			container.push_back(value);
 		}
+		void push(T &&value) {
+			container.push_back(std::move(value));
+		}
+		template <class... Args>
+		void emplace(Args &&...args) {
+			container.emplace_back(std::forward<Args>(args)...);
+		}
 		void pop() {
 			container.pop_back();
 		}
@@ -25,7 +35,7 @@ namespace bon {
 		}
 
 	private:
-		list<T> container;
+		Container container;
 	};
 }
 
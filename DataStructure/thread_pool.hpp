@@ -0,0 +1,264 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bon {
+	// ũ-ο ۾ ġ(work-stealing)  Ǯ
+	// ۾ڸ  , ڱ  ڿ  ٸ ۾  տ ħ
+	class thread_pool {
+	private:
+		struct task {
+			std::function<void()> func;
+			std::atomic<bool> bDone;
+			std::exception_ptr error;
+		};
+		struct task_queue {
+			std::mutex mutex;
+			std::deque<task *> tasks;
+		};
+		struct context {
+			thread_pool *pool;
+			int index;
+		};
+
+	public:
+		explicit thread_pool(int threadCount = static_cast<int>(std::thread::hardware_concurrency())) {
+			if (threadCount < 1)
+				threadCount = 1;
+
+			bStop = false;
+			queuedCount = 0;
+			sleepingCount = 0;
+
+			//   Ǯ  尡  ۾
+			for (int i = 0; i <= threadCount; i++)
+				queues.emplace_back(new task_queue());
+			for (int i = 0; i < threadCount; i++)
+				threads.emplace_back([this, i] { Work(i); });
+		}
+		~thread_pool() {
+			{
+				std::lock_guard<std::mutex> lock(sleepMutex);
+				bStop = true;
+			}
+			sleepCondition.notify_all();
+			for (auto &thread : threads)
+				thread.join();
+		}
+
+		thread_pool(const thread_pool &) = delete;
+		thread_pool &operator=(const thread_pool &) = delete;
+
+		// μ ü Բ  ⺻ Ǯ
+		static thread_pool &shared() {
+			static thread_pool pool;
+			return pool;
+		}
+
+		inline int size() const {
+			return static_cast<int>(threads.size());
+		}
+
+		// left right ķ ϰ     ٸ (ܴ ٽ )
+		template <class Left, class Right>
+		void invoke(Left &&left, Right &&right) {
+			context &current = CurrentContext();
+			if (current.pool != this) {
+				// Ǯ ۿ ȣǸ ۾ڿ Ѱ ϰ ٸ
+				run([&] { invoke(left, right); });
+				return;
+			}
+
+			task forked;
+			forked.func = std::forward<Right>(right);
+			forked.bDone = false;
+			Push(current.index, &forked);
+
+			std::exception_ptr leftError;
+			try {
+				left();
+			}
+			catch (...) {
+				leftError = std::current_exception();
+			}
+
+			//      , ϸ¾   ٸ ۾ 
+			if (PopBack(current.index, &forked))
+				Execute(&forked);
+			else {
+				while (!forked.bDone.load(std::memory_order_acquire)) {
+					task *other = FindTask(current.index);
+					if (other != nullptr)
+						Execute(other);
+					else
+						std::this_thread::yield();
+				}
+			}
+
+			if (leftError)
+				std::rethrow_exception(leftError);
+			if (forked.error)
+				std::rethrow_exception(forked.error);
+		}
+		// func Ǯ ϰ   ٸ
+		template <class Func>
+		void run(Func &&func) {
+			context &current = CurrentContext();
+			if (current.pool == this) {
+				func();
+				return;
+			}
+
+			std::mutex doneMutex;
+			std::condition_variable doneCondition;
+			bool bFinished = false;
+
+			task submitted;
+			submitted.func = [&] {
+				try {
+					func();
+				}
+				catch (...) {
+					submitted.error = std::current_exception();
+				}
+
+				std::lock_guard<std::mutex> lock(doneMutex);
+				bFinished = true;
+				doneCondition.notify_one();
+			};
+			submitted.bDone = false;
+			Push(size(), &submitted);
+
+			std::unique_lock<std::mutex> lock(doneMutex);
+			doneCondition.wait(lock, [&] { return bFinished; });
+			lock.unlock();
+
+			// ۾ڰ submitted Ϸ ǥø ĥ  ٷ     
+			while (!submitted.bDone.load(std::memory_order_acquire))
+				std::this_thread::yield();
+
+			if (submitted.error)
+				std::rethrow_exception(submitted.error);
+		}
+
+	private:
+		static context &CurrentContext() {
+			static thread_local context current = { nullptr, -1 };
+			return current;
+		}
+
+		void Work(int index) {
+			context &current = CurrentContext();
+			current.pool = this;
+			current.index = index;
+
+			while (!bStop) {
+				task *target = FindTask(index);
+				if (target != nullptr) {
+					Execute(target);
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(sleepMutex);
+				sleepingCount++;
+				sleepCondition.wait(lock, [this] { return bStop || queuedCount.load() > 0; });
+				sleepingCount--;
+			}
+		}
+		static void Execute(task *target) {
+			try {
+				target->func();
+			}
+			catch (...) {
+				target->error = std::current_exception();
+			}
+			target->bDone.store(true, std::memory_order_release);
+		}
+
+		void Push(int index, task *target) {
+			{
+				std::lock_guard<std::mutex> lock(queues[index]->mutex);
+				queues[index]->tasks.push_back(target);
+			}
+			queuedCount++;
+			//  ۾ڰ  sleepMutex   ,  Ȯϰ  ̿ ˸  ʰ 
+			if (sleepingCount.load() > 0) {
+				std::lock_guard<std::mutex> lock(sleepMutex);
+			}
+			sleepCondition.notify_one();
+		}
+		//   ۾ target̸ 
+		bool PopBack(int index, task *target) {
+			std::lock_guard<std::mutex> lock(queues[index]->mutex);
+			auto &tasks = queues[index]->tasks;
+			if (tasks.empty() || tasks.back() != target)
+				return false;
+
+			tasks.pop_back();
+			queuedCount--;
+			return true;
+		}
+		// ڱ  , ٸ    ۾ ã
+		task *FindTask(int index) {
+			if (queuedCount.load() == 0)
+				return nullptr;
+
+			task *target = nullptr;
+			{
+				std::lock_guard<std::mutex> lock(queues[index]->mutex);
+				auto &tasks = queues[index]->tasks;
+				if (!tasks.empty()) {
+					target = tasks.back();
+					tasks.pop_back();
+				}
+			}
+
+			int queueCount = static_cast<int>(queues.size());
+			for (int i = 1; target == nullptr && i < queueCount; i++) {
+				auto &victim = *queues[(index + i) % queueCount];
+				std::lock_guard<std::mutex> lock(victim.mutex);
+				if (!victim.tasks.empty()) {
+					target = victim.tasks.front();
+					victim.tasks.pop_front();
+				}
+			}
+
+			if (target != nullptr)
+				queuedCount--;
+			return target;
+		}
+
+	private:
+		std::vector<std::unique_ptr<task_queue>> queues;
+		std::vector<std::thread> threads;
+		std::atomic<bool> bStop;
+		std::atomic<int> queuedCount;
+		std::atomic<int> sleepingCount; // sleepMutex   ۾ 
+		std::mutex sleepMutex;
+		std::condition_variable sleepCondition;
+	};
+
+	//    ± (Ǯ    Ǯ )
+	struct parallel_t {
+		constexpr parallel_t() : pool(nullptr) {
+		}
+		explicit parallel_t(thread_pool &pool) : pool(&pool) {
+		}
+
+		thread_pool &get() const {
+			return (pool != nullptr) ? *pool : thread_pool::shared();
+		}
+
+		thread_pool *pool;
+	};
+	constexpr parallel_t parallel{};
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+namespace bon {
+	// Է  ̹ ĵǾ ְ ߺ  Ÿ ±
+	struct sorted_unique_t {
+	};
+	constexpr sorted_unique_t sorted_unique{};
+
+	template <class Allocator, class = void>
+	struct HasRelease : std::false_type {
+	};
+	template <class Allocator>
+	struct HasRelease<Allocator, decltype(std::declval<Allocator &>().release(), void())> : std::true_type {
+	};
+	// ٸ Ҵڰ  带 Ѱܹ޾   ִ (Ǯ Ҵ share)
+	template <class Allocator, class = void>
+	struct HasShare : std::false_type {
+	};
+	template <class Allocator>
+	struct HasShare<Allocator, decltype(std::declval<Allocator &>().share(std::declval<const Allocator &>()), void())> : std::true_type {
+	};
+	// ٸ Ҵ ûũ ° Ѱܹ  ִ (Ǯ Ҵ splice)
+	template <class Allocator, class = void>
+	struct HasSplice : std::false_type {
+	};
+	template <class Allocator>
+	struct HasSplice<Allocator, decltype(std::declval<Allocator &>().splice(std::declval<Allocator &>()), void())> : std::true_type {
+	};
+
+	//  ü Ű 
+	template <typename T>
+	struct identity_key {
+		using key_type = T;
+
+		const T &operator()(const T &value) const {
+			return value;
+		}
+	};
+
+	// ڿ is_transparent  key_type ƴ Űε Ž 
+	template <class Compare, class Key, class = void>
+	struct IsTransparent : std::false_type {
+	};
+	template <class Compare, class Key>
+	struct IsTransparent<Compare, Key, typename std::conditional<true, void, typename Compare::is_transparent>::type> : std::true_type {
+	};
+	// ڸ Ű   ȣ  ִ (map 迭 Compare pair ƴ϶ Ű )
+	template <class Compare, class Key, class = void>
+	struct IsKeyCompare : std::false_type {
+	};
+	template <class Compare, class Key>
+	struct IsKeyCompare<Compare, Key, decltype(std::declval<const Compare &>()(std::declval<const Key &>(), std::declval<const Key &>()), void())> : std::true_type {
+	};
+
+	// pair first Ű 
+	template <typename K, typename V>
+	struct select_first {
+		using key_type = K;
+
+		const K &operator()(const std::pair<K, V> &value) const {
+			return value.first;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace bon {
+	template <typename T>
+	class vector {
+	public:
+		using iterator			= T *;
+		using const_iterator	= const T *;
+
+		vector() : buffer(nullptr), capacity(0), length(0) {
+		}
+		vector(std::initializer_list<T> initList) : vector() {
+			reserve(static_cast<int>(initList.size()));
+			for (const T &element : initList)
+				push_back(element);
+		}
+		vector(const vector &target) : vector() {
+			reserve(target.length);
+			for (int i = 0; i < target.length; i++)
+				push_back(target.buffer[i]);
+		}
+		vector(vector &&target) noexcept : vector() {
+			swap(target);
+		}
+		~vector() {
+			clear();
+			::operator delete(buffer);
+		}
+
+		const vector &operator=(const vector &target) {
+			if (this != &target) {
+				vector temp(target);
+				swap(temp);
+			}
+			return *this;
+		}
+		const vector &operator=(vector &&target) noexcept {
+			if (this != &target) {
+				clear();
+				swap(target);
+			}
+			return *this;
+		}
+
+		T &operator[](int index) {
+			return buffer[index];
+		}
+		const T &operator[](int index) const {
+			return buffer[index];
+		}
+
+		T &front() {
+			if (empty())
+				throw new std::runtime_error("front() called on empty vector");
+			return buffer[0];
+		}
+		const T &front() const {
+			if (empty())
+				throw new std::runtime_error("front() called on empty vector");
+			return buffer[0];
+		}
+		T &back() {
+			if (empty())
+				throw new std::runtime_error("back() called on empty vector");
+			return buffer[length - 1];
+		}
+		const T &back() const {
+			if (empty())
+				throw new std::runtime_error("back() called on empty vector");
+			return buffer[length - 1];
+		}
+
+		iterator begin() {
+			return buffer;
+		}
+		iterator end() {
+			return buffer + length;
+		}
+		const_iterator begin() const {
+			return buffer;
+		}
+		const_iterator end() const {
+			return buffer + length;
+		}
+
+		void push_back(const T &value) {
+			emplace_back(value);
+		}
+		void push_back(T &&value) {
+			emplace_back(std::move(value));
+		}
+		template <class... Args>
+		T &emplace_back(Args &&...args) {
+			if (length == capacity) {
+				// ڰ   Ҹ ų  Ƿ    Ȯ
+				T value(std::forward<Args>(args)...);
+				grow(capacity != 0 ? capacity * 2 : INITIAL_CAPACITY);
+				return construct(std::move(value));
+			}
+
+			return construct(std::forward<Args>(args)...);
+		}
+		void pop_back() {
+			if (empty())
+				throw new std::runtime_error("pop_back() called on empty vector");
+
+			buffer[--length].~T();
+		}
+
+		void reserve(int count) {
+			if (count > capacity)
+				grow(count);
+		}
+
+		inline int size() const {
+			return length;
+		}
+		inline bool empty() const {
+			return length == 0;
+		}
+		void clear() {
+			for (int i = 0; i < length; i++)
+				buffer[i].~T();
+			length = 0;
+		}
+		void swap(vector &target) noexcept {
+			std::swap(buffer, target.buffer);
+			std::swap(capacity, target.capacity);
+			std::swap(length, target.length);
+		}
+
+	private:
+		template <class... Args>
+		T &construct(Args &&...args) {
+			T *target = &buffer[length];
+			new (target) T(std::forward<Args>(args)...);
+			length++;
+			return *target;
+		}
+		void grow(int newCapacity) {
+			T *newBuffer = static_cast<T *>(::operator new(newCapacity * sizeof(T)));
+
+			//   ۷ ű ڿ  Ҹ Ҹ (  ܰ   ۴ ״)
+			int built = 0;
+			try {
+				for (; built < length; built++)
+					new (&newBuffer[built]) T(std::move_if_noexcept(buffer[built]));
+			}
+			catch (...) {
+				for (int i = 0; i < built; i++)
+					newBuffer[i].~T();
+				::operator delete(newBuffer);
+				throw;
+			}
+
+			for (int i = 0; i < length; i++)
+				buffer[i].~T();
+			::operator delete(buffer);
+			buffer = newBuffer;
+			capacity = newCapacity;
+		}
+
+	private:
+		static const int INITIAL_CAPACITY = 16;
+
+		T *buffer;
+		int capacity;
+		int length;
+	};
+}
\ No newline at end of file
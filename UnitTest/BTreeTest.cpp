@@ -0,0 +1,132 @@
+#include "CppUnitTest.h"
+#include <set>
+#include <string>
+#include "../DataStructure/btree_set.hpp"
+#include "../DataStructure/btree_map.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(BTreeTest) {
+	public:
+		template<typename T>
+		static void AssertEqual(const std::set<T> &expected, const bon::btree_set<T> &actual) {
+			Assert::AreEqual(static_cast<int>(expected.size()), actual.size());
+			auto actualIter = actual.begin();
+			for (auto expectedIter = expected.begin(); expectedIter != expected.end(); expectedIter++, actualIter++)
+				Assert::AreEqual(*expectedIter, *actualIter);
+			Assert::IsTrue(actualIter == actual.end());
+		}
+
+		TEST_METHOD(checkInsertIgnoresDuplicate) {
+			bon::btree_set<int> actualSet({ 3, 1, 2, 3, 1 });
+
+			AssertEqual(std::set<int>({ 1, 2, 3 }), actualSet);
+		}
+		TEST_METHOD(checkSplitAndMerge) {
+			//   ҵǵ       
+			const int COUNT = 10000;
+			bon::btree_set<int> actualSet;
+			std::set<int> expectedSet;
+			for (int i = 0; i < COUNT; i++) {
+				int value = (i * 7919) % COUNT;
+				actualSet.insert(value);
+				expectedSet.insert(value);
+			}
+			AssertEqual(expectedSet, actualSet);
+
+			for (int i = 0; i < COUNT; i += 2) {
+				actualSet.erase(i);
+				expectedSet.erase(i);
+			}
+			AssertEqual(expectedSet, actualSet);
+		}
+		TEST_METHOD(checkEraseReturnsNext) {
+			bon::btree_set<int> actualSet;
+			for (int i = 0; i < 1000; i++)
+				actualSet.insert(i);
+
+			auto iter = actualSet.find(500);
+			iter = actualSet.erase(iter);
+			Assert::AreEqual(501, *iter);
+
+			iter = actualSet.erase(actualSet.find(999));
+			Assert::IsTrue(iter == actualSet.end());
+		}
+		TEST_METHOD(checkReverseIteration) {
+			bon::btree_set<int> actualSet;
+			for (int i = 0; i < 1000; i++)
+				actualSet.insert(i);
+
+			int expected = 999;
+			for (auto iter = actualSet.end(); iter != actualSet.begin(); expected--)
+				Assert::AreEqual(expected, *--iter);
+			Assert::AreEqual(-1, expected);
+		}
+		TEST_METHOD(checkBounds) {
+			bon::btree_set<int> actualSet({ 10, 20, 30 });
+
+			Assert::AreEqual(20, *actualSet.lower_bound(20));
+			Assert::AreEqual(30, *actualSet.upper_bound(20));
+			Assert::AreEqual(10, *actualSet.lower_bound(5));
+			Assert::IsTrue(actualSet.lower_bound(31) == actualSet.end());
+			Assert::IsTrue(actualSet.find(15) == actualSet.end());
+		}
+		TEST_METHOD(checkInsertWithHint) {
+			bon::btree_set<int> actualSet;
+			std::set<int> expected;
+
+			//  hint ĵ   Ź   ܸ    (  )
+			for (int i = 0; i < 1000; i += 2) {
+				Assert::AreEqual(i, *actualSet.insert(actualSet.end(), i));
+				expected.insert(i);
+			}
+			// ´ hint,  ʴ hint, ̹ ִ 
+			Assert::AreEqual(11, *actualSet.insert(actualSet.find(12), 11));
+			Assert::AreEqual(501, *actualSet.emplace_hint(actualSet.begin(), 501));
+			Assert::AreEqual(-1, *actualSet.emplace_hint(actualSet.end(), -1));
+			Assert::AreEqual(20, *actualSet.insert(actualSet.find(30), 20));
+			expected.insert({ 11, 501, -1 });
+			AssertEqual(expected, actualSet);
+
+			bon::btree_set<int, std::less<int>, bon::pool_allocator<int>, 64> smallNodeSet;
+			for (int i = 0; i < 100; i++)
+				smallNodeSet.emplace_hint(smallNodeSet.end(), i);
+			Assert::AreEqual(100, smallNodeSet.size());
+			Assert::AreEqual(99, *--smallNodeSet.end());
+		}
+		TEST_METHOD(checkMapHeterogeneousFind) {
+			bon::btree_map<std::string, int, std::less<>> actualMap({ {"apple", 1}, {"banana", 2} });
+
+			Assert::AreEqual(2, actualMap.find("banana")->second);
+			Assert::AreEqual(1, actualMap.at("apple"));
+			Assert::IsTrue(actualMap.find("cherry") == actualMap.end());
+		}
+		TEST_METHOD(checkMapOperatorBracketInserts) {
+			bon::btree_map<int, int> actualMap;
+			int expected[500] = {};
+			//   Ͼ   Ҹ Ű Ȯ
+			for (int i = 0; i < 1000; i++) {
+				actualMap[(i * 37) % 500] += i;
+				expected[(i * 37) % 500] += i;
+			}
+
+			Assert::AreEqual(500, actualMap.size());
+			for (int key = 0; key < 500; key++)
+				Assert::AreEqual(expected[key], actualMap.at(key));
+			Assert::AreEqual(0, actualMap[1000]);
+			Assert::AreEqual(501, actualMap.size());
+		}
+		TEST_METHOD(checkMapAtMissingKey) {
+			bon::btree_map<int, int> actualMap({ {1, 10} });
+
+			try {
+				actualMap.at(2);
+				Assert::Fail();
+			}
+			catch (std::out_of_range *error) {
+				delete error;
+			}
+		}
+	};
+}
\ No newline at end of file
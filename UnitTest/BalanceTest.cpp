@@ -0,0 +1,194 @@
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include "../DataStructure/map.hpp"
+#include "../DataStructure/set.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(BalanceTest) {
+	public:
+		template <class Balance>
+		using rankedSet = bon::set<int, std::less<int>, bon::pool_allocator<int>, bon::order_statistic, Balance>;
+
+		// 带  󰡸 å ũ Ģ θ  Ȯ (header ȣ ̹Ƿ Ļ Ŭ  ͷ )
+		template <class Balance>
+		struct inspector : rankedSet<Balance> {
+			using node_base = typename rankedSet<Balance>::node_base;
+
+			// θ    Բ Ȯ
+			static void checkStructure(const rankedSet<Balance> &tree) {
+				const node_base &header = tree.*(&inspector::header);
+				Assert::AreEqual(tree.size(), checkNode(header.left, &header, Balance()));
+			}
+
+			static int RankOf(const node_base *target) {
+				return (target != nullptr) ? target->height : 0;
+			}
+			// AVL: ũ Ȯ ,  ڽ   1 
+			static int checkNode(const node_base *target, const node_base *parent, bon::avl_balance policy) {
+				if (target == nullptr)
+					return 0;
+
+				Assert::IsTrue(target->parent == parent);
+				int count = 1 + checkNode(target->left, target, policy) + checkNode(target->right, target, policy);
+				int leftRank = RankOf(target->left), rightRank = RankOf(target->right);
+				Assert::IsTrue(std::abs(leftRank - rightRank) <= 1);
+				Assert::AreEqual(std::max(leftRank, rightRank) + 1, target->height);
+				return count;
+			}
+			// WAVL: ũ ̴ 1 Ǵ 2, ܸ ũ 1
+			static int checkNode(const node_base *target, const node_base *parent, bon::wavl_balance policy) {
+				if (target == nullptr)
+					return 0;
+
+				Assert::IsTrue(target->parent == parent);
+				int count = 1 + checkNode(target->left, target, policy) + checkNode(target->right, target, policy);
+				for (const node_base *child : { target->left, target->right }) {
+					int difference = target->height - RankOf(child);
+					Assert::IsTrue(difference == 1 || difference == 2);
+				}
+				if (target->left == nullptr && target->right == nullptr)
+					Assert::AreEqual(1, target->height);
+				return count;
+			}
+			// -: ũ ̴ 0 Ǵ 1, 0-ڽ() ڽ  1-ڽ
+			static int checkNode(const node_base *target, const node_base *parent, bon::rb_balance policy) {
+				if (target == nullptr)
+					return 0;
+
+				Assert::IsTrue(target->parent == parent);
+				int count = 1 + checkNode(target->left, target, policy) + checkNode(target->right, target, policy);
+				for (const node_base *child : { target->left, target->right }) {
+					int difference = target->height - RankOf(child);
+					Assert::IsTrue(difference == 0 || difference == 1);
+					if (child != nullptr && difference == 0) {
+						Assert::AreEqual(1, child->height - RankOf(child->left));
+						Assert::AreEqual(1, child->height - RankOf(child->right));
+					}
+				}
+				return count;
+			}
+		};
+
+		//  /  std::set    ϴ Ȯ
+		template <class Balance>
+		static void checkRandomOperations() {
+			std::mt19937 random(11);
+			rankedSet<Balance> actualSet;
+			std::set<int> expectedSet;
+
+			for (int i = 0; i < 20000; i++) {
+				int value = static_cast<int>(random() % 2000);
+				if (random() % 2) {
+					actualSet.insert(value);
+					expectedSet.insert(value);
+				}
+				else {
+					actualSet.erase(value);
+					expectedSet.erase(value);
+				}
+				if (i % 1000 == 0)
+					inspector<Balance>::checkStructure(actualSet);
+			}
+			inspector<Balance>::checkStructure(actualSet);
+
+			Assert::AreEqual(static_cast<int>(expectedSet.size()), actualSet.size());
+			int index = 0;
+			for (int value : expectedSet) {
+				Assert::AreEqual(value, *actualSet.nth(index));
+				Assert::AreEqual(index, actualSet.rank(value));
+				index++;
+			}
+		}
+		template <class Balance>
+		static void checkSplitAndJoin() {
+			rankedSet<Balance> actualSet;
+			for (int i = 0; i < 1000; i++)
+				actualSet.insert(i);
+			for (int i = 0; i < 1000; i += 3)
+				actualSet.erase(i);
+
+			rankedSet<Balance> rightSet = actualSet.split(500);
+			Assert::AreEqual(500, *rightSet.begin());
+			Assert::AreEqual(499, *--actualSet.end());
+			inspector<Balance>::checkStructure(actualSet);
+			inspector<Balance>::checkStructure(rightSet);
+
+			rightSet.insert(2000);
+			actualSet.join(std::move(rightSet));
+			Assert::AreEqual(667, actualSet.size());
+			Assert::AreEqual(666, actualSet.rank(2000));
+			inspector<Balance>::checkStructure(actualSet);
+		}
+		// ũⰡ ũ ٸ Ʈ   ڿ ũ Ģ Ǵ Ȯ
+		template <class Balance>
+		static void checkSetOperations() {
+			std::mt19937 random(7);
+			for (int round = 0; round < 3; round++) {
+				rankedSet<Balance> actualSet, otherSet;
+				std::set<int> expectedSet, otherValues;
+				for (int i = 0; i < 3000; i++) {
+					int value = static_cast<int>(random() % 5000);
+					actualSet.insert(value);
+					expectedSet.insert(value);
+				}
+				for (int i = 0; i < 300; i++) {
+					int value = static_cast<int>(random() % 5000);
+					otherSet.insert(value);
+					otherValues.insert(value);
+				}
+
+				std::set<int> resultSet;
+				if (round == 0) {
+					actualSet.set_union(std::move(otherSet));
+					std::set_union(expectedSet.begin(), expectedSet.end(), otherValues.begin(), otherValues.end(), std::inserter(resultSet, resultSet.end()));
+				}
+				else if (round == 1) {
+					actualSet.set_intersection(std::move(otherSet));
+					std::set_intersection(expectedSet.begin(), expectedSet.end(), otherValues.begin(), otherValues.end(), std::inserter(resultSet, resultSet.end()));
+				}
+				else {
+					actualSet.set_difference(std::move(otherSet));
+					std::set_difference(expectedSet.begin(), expectedSet.end(), otherValues.begin(), otherValues.end(), std::inserter(resultSet, resultSet.end()));
+				}
+
+				inspector<Balance>::checkStructure(actualSet);
+				Assert::AreEqual(static_cast<int>(resultSet.size()), actualSet.size());
+				Assert::IsTrue(std::equal(resultSet.begin(), resultSet.end(), actualSet.begin()));
+			}
+		}
+
+		TEST_METHOD(checkAVL) {
+			checkRandomOperations<bon::avl_balance>();
+			checkSplitAndJoin<bon::avl_balance>();
+			checkSetOperations<bon::avl_balance>();
+		}
+		TEST_METHOD(checkWeakAVL) {
+			checkRandomOperations<bon::wavl_balance>();
+			checkSplitAndJoin<bon::wavl_balance>();
+			checkSetOperations<bon::wavl_balance>();
+		}
+		TEST_METHOD(checkRedBlack) {
+			checkRandomOperations<bon::rb_balance>();
+			checkSplitAndJoin<bon::rb_balance>();
+			checkSetOperations<bon::rb_balance>();
+		}
+		TEST_METHOD(checkMapWithPolicy) {
+			bon::map<int, std::string, std::less<int>, bon::pool_allocator<std::pair<int, std::string>>, bon::no_augment, bon::rb_balance> actualMap;
+			for (int i = 0; i < 100; i++)
+				actualMap.insert(std::make_pair(i, std::to_string(i)));
+			for (int i = 0; i < 100; i += 2)
+				actualMap.erase(i);
+
+			Assert::AreEqual(50, actualMap.size());
+			Assert::AreEqual(std::string("51"), actualMap.at(51));
+			Assert::IsTrue(actualMap.find(50) == actualMap.end());
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "CppUnitTest.h"
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include "../DataStructure/map.hpp"
+#include "../DataStructure/set.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(CompactTest) {
+	public:
+		using compactSet = bon::set<uint32_t, std::less<uint32_t>, bon::compact_storage>;
+		using compactMap = bon::map<int, std::string, std::less<int>, bon::compact_storage>;
+
+		static void AssertEqual(const std::set<uint32_t> &expected, const compactSet &actual) {
+			Assert::AreEqual(static_cast<int>(expected.size()), actual.size());
+			auto actualIter = actual.begin();
+			for (auto expectedIter = expected.begin(); expectedIter != expected.end(); expectedIter++, actualIter++)
+				Assert::AreEqual(*expectedIter, *actualIter);
+			Assert::IsTrue(actualIter == actual.end());
+		}
+
+		TEST_METHOD(checkRandomInsertErase) {
+			std::mt19937 random(3);
+			compactSet actualSet;
+			std::set<uint32_t> expected;
+
+			for (int i = 0; i < 20000; i++) {
+				uint32_t key = random() % 5000;
+				if (random() % 3 != 0) {
+					actualSet.insert(key);
+					expected.insert(key);
+				}
+				else {
+					actualSet.erase(key);
+					expected.erase(key);
+				}
+			}
+
+			AssertEqual(expected, actualSet);
+			for (uint32_t key = 0; key < 5000; key += 7) {
+				auto expectedLower = expected.lower_bound(key);
+				auto actualLower = actualSet.lower_bound(key);
+				Assert::AreEqual(expectedLower == expected.end(), actualLower == actualSet.end());
+				if (expectedLower != expected.end())
+					Assert::AreEqual(*expectedLower, *actualLower);
+			}
+		}
+		TEST_METHOD(checkIteratorSurvivesGrowth) {
+			compactSet actualSet({ 10 });
+			auto iter = actualSet.find(10);
+
+			// 迭   Ŀ ݺڴ ε̹Ƿ ״ ȿ
+			for (uint32_t i = 0; i < 1000; i++)
+				actualSet.insert(i * 20 + 11);
+			Assert::AreEqual(10u, *iter);
+			Assert::AreEqual(11u, *++iter);
+			Assert::AreEqual(10u, *--iter);
+			Assert::AreEqual(19991u, *--actualSet.end());
+		}
+		TEST_METHOD(checkIteratorAfterEraseAndMove) {
+			compactSet actualSet;
+			for (uint32_t i = 0; i < 100; i++)
+				actualSet.insert(i);
+
+			// ٸ Ҹ   ε ״̹Ƿ ݺڴ ȿ
+			auto iter = actualSet.find(50);
+			for (uint32_t i = 0; i < 100; i += 2) {
+				if (i != 50)
+					actualSet.erase(i);
+			}
+			Assert::AreEqual(50u, *iter);
+			Assert::AreEqual(51u, *++iter);
+
+			// ݺڴ Ʈ ü  Ƿ ̵ ȯ ڿ Ű  Ʈ ٽ 
+			compactSet movedSet(std::move(actualSet));
+			compactSet otherSet({ 1000 });
+			std::swap(movedSet, otherSet);
+			iter = otherSet.find(50);
+			Assert::AreEqual(50u, *iter);
+			Assert::AreEqual(49u, *--iter);
+			Assert::AreEqual(1000u, *movedSet.begin());
+			Assert::IsTrue(actualSet.empty());
+			Assert::AreEqual(0u, *actualSet.insert(actualSet.end(), 0u));
+		}
+		TEST_METHOD(checkEraseReusesSlots) {
+			compactSet actualSet;
+			for (uint32_t i = 0; i < 1000; i++)
+				actualSet.insert(i);
+			size_t usage = actualSet.memory_usage();
+
+			for (uint32_t i = 0; i < 1000; i += 2)
+				actualSet.erase(i);
+			for (uint32_t i = 1000; i < 1500; i++)
+				actualSet.insert(i);
+			Assert::AreEqual(usage, actualSet.memory_usage());
+			Assert::AreEqual(1000, actualSet.size());
+		}
+		TEST_METHOD(checkInsertWithHint) {
+			compactSet actualSet({ 10, 20, 30 });
+
+			Assert::AreEqual(40u, *actualSet.insert(actualSet.end(), 40u));
+			Assert::AreEqual(15u, *actualSet.insert(actualSet.find(20), 15u));
+			Assert::AreEqual(25u, *actualSet.emplace_hint(actualSet.begin(), 25u));
+			Assert::AreEqual(20u, *actualSet.insert(actualSet.find(30), 20u));
+			AssertEqual({ 10, 15, 20, 25, 30, 40 }, actualSet);
+		}
+		TEST_METHOD(checkSplitJoin) {
+			compactSet actualSet({ 1, 2, 3, 4, 5, 6 });
+
+			compactSet upperSet = actualSet.split(3);
+			AssertEqual({ 1, 2 }, actualSet);
+			AssertEqual({ 3, 4, 5, 6 }, upperSet);
+
+			actualSet.join(std::move(upperSet));
+			AssertEqual({ 1, 2, 3, 4, 5, 6 }, actualSet);
+			Assert::IsTrue(upperSet.empty());
+		}
+		TEST_METHOD(checkMap) {
+			compactMap actualMap({ { 2, "two" }, { 1, "one" } });
+			actualMap.emplace(3, "three");
+
+			compactMap copiedMap(actualMap);
+			actualMap.erase(1);
+			Assert::AreEqual(2, actualMap.size());
+			Assert::AreEqual(std::string("three"), actualMap.at(3));
+			Assert::AreEqual(3, copiedMap.size());
+			Assert::AreEqual(std::string("one"), copiedMap.at(1));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "CppUnitTest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "../DataStructure/concurrent_map.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(ConcurrentMapTest) {
+	public:
+		TEST_METHOD(checkInsertFindErase) {
+			bon::concurrent_map<int, int> actualMap({ {1, 10}, {2, 20} });
+			int value = 0;
+
+			Assert::IsTrue(actualMap.insert({ 3, 30 }));
+			Assert::IsFalse(actualMap.insert({ 3, 0 }));
+			Assert::IsTrue(actualMap.find(3, value));
+			Assert::AreEqual(30, value);
+
+			Assert::AreEqual(1, actualMap.erase(1));
+			Assert::IsFalse(actualMap.contains(1));
+			Assert::AreEqual(2, actualMap.size());
+		}
+		TEST_METHOD(checkSnapshotIsolation) {
+			bon::concurrent_map<int, int> actualMap({ {1, 10} });
+
+			auto snapshot = actualMap.snapshot();
+			actualMap.insert_or_assign(1, 100);
+			actualMap.insert({ 2, 20 });
+
+			Assert::AreEqual(10, snapshot.at(1));
+			Assert::AreEqual(1, snapshot.size());
+			Assert::AreEqual(100, actualMap.snapshot().at(1));
+		}
+		TEST_METHOD(checkUpdateIsAtomic) {
+			bon::concurrent_map<int, int> actualMap;
+
+			actualMap.update([](bon::persistent_map<int, int> &target) {
+				for (int i = 0; i < 100; i++)
+					target.insert({ i, i });
+			});
+			Assert::AreEqual(100, actualMap.size());
+		}
+
+		// writer 0 ʷ ִ  бⰡ ׻ ƴ պκ  Ȯ
+		TEST_METHOD(checkReadersDuringWrites) {
+			const int COUNT = 20000;
+			bon::concurrent_map<int, int> actualMap;
+			std::atomic<bool> bFinished(false);
+			std::atomic<int> errors(0);
+
+			std::vector<std::thread> readers;
+			for (int r = 0; r < 4; r++) {
+				readers.emplace_back([&] {
+					while (!bFinished.load()) {
+						bool bConsistent = actualMap.read([](const bon::persistent_map<int, int> &target) {
+							int expected = 0;
+							for (auto &pair : target) {
+								if (pair.first != expected++ || pair.second != pair.first)
+									return false;
+							}
+							return expected == target.size();
+						});
+						if (!bConsistent)
+							errors++;
+					}
+				});
+			}
+
+			for (int i = 0; i < COUNT; i++)
+				actualMap.insert({ i, i });
+			bFinished = true;
+			for (auto &reader : readers)
+				reader.join();
+
+			Assert::AreEqual(0, errors.load());
+			Assert::AreEqual(COUNT, actualMap.size());
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "CppUnitTest.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "../DataStructure/concurrent_queue.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(ConcurrentQueueTest) {
+	public:
+		TEST_METHOD(checkInvalidCapacity) {
+			auto func = [] { bon::concurrent_queue<int> actualQueue(100); };
+
+			Assert::ExpectException<std::invalid_argument>(func);
+		}
+		TEST_METHOD(checkTryPushIfFull) {
+			bon::concurrent_queue<int> actualQueue(4);
+
+			for (int i = 0; i < 4; i++)
+				Assert::IsTrue(actualQueue.try_push(i));
+
+			Assert::IsFalse(actualQueue.try_push(4));
+			Assert::AreEqual(4, actualQueue.size());
+		}
+		TEST_METHOD(checkTryPopIfEmpty) {
+			bon::concurrent_queue<int> actualQueue(4);
+			int value = 0;
+
+			Assert::IsFalse(actualQueue.try_pop(value));
+		}
+		TEST_METHOD(checkFifoOrder) {
+			bon::concurrent_queue<int> actualQueue(8);
+			int value = 0;
+
+			for (int round = 0; round < 3; round++) {
+				for (int i = 0; i < 6; i++)
+					actualQueue.push(i);
+				for (int i = 0; i < 6; i++) {
+					actualQueue.pop(value);
+					Assert::AreEqual(i, value);
+				}
+			}
+
+			Assert::IsTrue(actualQueue.empty());
+		}
+		TEST_METHOD(checkDestructorReleasesRemaining) {
+			std::shared_ptr<int> tracked = std::make_shared<int>(1);
+			{
+				bon::concurrent_queue<std::shared_ptr<int>> actualQueue(4);
+				actualQueue.push(tracked);
+				actualQueue.push(tracked);
+			}
+
+			Assert::AreEqual(1, static_cast<int>(tracked.use_count()));
+		}
+
+		//  /Һڰ ÿ ص Ұ ų ߺ ʴ Ȯ
+		TEST_METHOD(checkStressNoLostOrDuplicatedItems) {
+			const int PRODUCER_COUNT = 4, CONSUMER_COUNT = 4;
+			const int ITEM_PER_PRODUCER = 200000;
+			const int TOTAL = PRODUCER_COUNT * ITEM_PER_PRODUCER;
+
+			bon::concurrent_queue<int> actualQueue(256);
+			std::vector<std::atomic<int>> seen(TOTAL);
+			std::atomic<int> consumed(0);
+			std::vector<std::thread> threads;
+
+			for (auto &count : seen)
+				count.store(0);
+
+			for (int p = 0; p < PRODUCER_COUNT; p++) {
+				threads.emplace_back([&, p] {
+					for (int i = 0; i < ITEM_PER_PRODUCER; i++)
+						actualQueue.push(p * ITEM_PER_PRODUCER + i);
+				});
+			}
+			for (int c = 0; c < CONSUMER_COUNT; c++) {
+				threads.emplace_back([&] {
+					int value;
+					while (consumed.load() < TOTAL) {
+						if (actualQueue.try_pop(value)) {
+							seen[value].fetch_add(1);
+							consumed.fetch_add(1);
+						}
+						else
+							std::this_thread::yield();
+					}
+				});
+			}
+			for (auto &thread : threads)
+				thread.join();
+
+			Assert::AreEqual(TOTAL, consumed.load());
+			Assert::IsTrue(actualQueue.empty());
+			for (int i = 0; i < TOTAL; i++)
+				Assert::AreEqual(1, seen[i].load());
+		}
+	};
+}
\ No newline at end of file
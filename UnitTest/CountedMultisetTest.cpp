@@ -0,0 +1,57 @@
+#include "CppUnitTest.h"
+#include <iterator>
+#include <vector>
+#include "../DataStructure/counted_multiset.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(CountedMultisetTest) {
+	public:
+		static void AssertEqual(std::initializer_list<int> expected, const bon::counted_multiset<int> &actual) {
+			Assert::AreEqual(static_cast<int>(expected.size()), actual.size());
+			auto actualIter = actual.begin();
+			for (auto expectedIter = expected.begin(); expectedIter != expected.end(); expectedIter++, actualIter++)
+				Assert::AreEqual(*expectedIter, *actualIter);
+			Assert::IsTrue(actualIter == actual.end());
+		}
+
+		TEST_METHOD(checkIterationRepeatsCopies) {
+			bon::counted_multiset<int> actualSet({ 3, 1, 3, 2, 3, 1 });
+
+			AssertEqual({ 1, 1, 2, 3, 3, 3 }, actualSet);
+			Assert::AreEqual(3, actualSet.distinct_size());
+			Assert::AreEqual(3, *--actualSet.end());
+			Assert::AreEqual(2, static_cast<int>(std::distance(actualSet.begin(), actualSet.find(2))));
+		}
+		TEST_METHOD(checkCount) {
+			bon::counted_multiset<int> actualSet;
+			for (int i = 0; i < 1000; i++)
+				actualSet.insert(i % 10);
+			actualSet.insert(5, 100);
+
+			Assert::AreEqual(100, actualSet.count(0));
+			Assert::AreEqual(200, actualSet.count(5));
+			Assert::AreEqual(0, actualSet.count(10));
+			Assert::AreEqual(1100, actualSet.size());
+			Assert::AreEqual(10, actualSet.distinct_size());
+		}
+		TEST_METHOD(checkEraseValueDropsRun) {
+			bon::counted_multiset<int> actualSet({ 1, 2, 2, 2, 3 });
+
+			Assert::AreEqual(3, actualSet.erase(2));
+			Assert::AreEqual(0, actualSet.erase(2));
+			AssertEqual({ 1, 3 }, actualSet);
+		}
+		TEST_METHOD(checkEraseIteratorDropsOneCopy) {
+			bon::counted_multiset<int> actualSet({ 1, 2, 2, 3 });
+
+			//  纻    Ѿ
+			auto iter = actualSet.erase(std::next(actualSet.begin(), 2));
+			Assert::AreEqual(3, *iter);
+			iter = actualSet.erase(actualSet.find(2));
+			Assert::AreEqual(3, *iter);
+			AssertEqual({ 1, 3 }, actualSet);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include "CppUnitTest.h"
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../DataStructure/flat_set.hpp"
+#include "../DataStructure/flat_map.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(FlatTest) {
+	public:
+		//  Ű   ܸ 
+		struct fragile {
+			int key;
+
+			fragile(int key) : key(key) {
+			}
+			fragile(const fragile &target) : key(target.key) {
+				if (key < 0)
+					throw new std::runtime_error("fragile copy");
+			}
+			fragile &operator=(const fragile &target) = default;
+
+			bool operator<(const fragile &target) const {
+				return key < target.key;
+			}
+		};
+
+		template<typename T>
+		static void AssertEqual(const std::set<T> &expected, const bon::flat_set<T> &actual) {
+			Assert::AreEqual(static_cast<int>(expected.size()), actual.size());
+			auto actualIter = actual.begin();
+			for (auto expectedIter = expected.begin(); expectedIter != expected.end(); expectedIter++, actualIter++)
+				Assert::AreEqual(*expectedIter, *actualIter);
+		}
+
+		TEST_METHOD(checkInsertIgnoresDuplicate) {
+			bon::flat_set<int> actualSet({ 3, 1, 2, 3, 1 });
+			actualSet.insert(2);
+			actualSet.insert(0);
+
+			AssertEqual(std::set<int>({ 0, 1, 2, 3 }), actualSet);
+		}
+		TEST_METHOD(checkBatchInsert) {
+			bon::flat_set<int> actualSet({ 10, 20, 30 });
+			std::vector<int> batch({ 35, 5, 20, 15, 5 });
+
+			actualSet.insert(batch.begin(), batch.end());
+			AssertEqual(std::set<int>({ 5, 10, 15, 20, 30, 35 }), actualSet);
+		}
+		TEST_METHOD(checkBatchInsertKeepsExisting) {
+			bon::flat_map<int, std::string> actualMap({ {1, "one"}, {2, "two"} });
+			std::vector<std::pair<int, std::string>> batch({ {2, "second"}, {3, "three"}, {3, "third"} });
+
+			actualMap.insert(batch.begin(), batch.end());
+			Assert::AreEqual(3, actualMap.size());
+			Assert::AreEqual(std::string("two"), actualMap.at(2));
+			Assert::AreEqual(std::string("three"), actualMap.at(3));
+		}
+		TEST_METHOD(checkBatchInsertFailureKeepsContents) {
+			bon::flat_set<fragile> actualSet({ 30, 10, 20 });
+			std::vector<fragile> batch;
+			batch.reserve(3);
+			batch.emplace_back(25);
+			batch.emplace_back(5);
+			batch.emplace_back(-1); //   
+
+			try {
+				actualSet.insert(batch.begin(), batch.end());
+				Assert::Fail();
+			}
+			catch (std::runtime_error *error) {
+				delete error;
+			}
+
+			Assert::AreEqual(3, actualSet.size());
+			int expected = 10;
+			for (const fragile &value : actualSet) {
+				Assert::AreEqual(expected, value.key);
+				expected += 10;
+			}
+		}
+		TEST_METHOD(checkErase) {
+			bon::flat_set<int> actualSet({ 1, 2, 3, 4, 5 });
+
+			actualSet.erase(3);
+			auto iter = actualSet.erase(actualSet.find(4));
+			Assert::AreEqual(5, *iter);
+			AssertEqual(std::set<int>({ 1, 2, 5 }), actualSet);
+		}
+		TEST_METHOD(checkBounds) {
+			bon::flat_set<int> actualSet({ 10, 20, 30 });
+
+			Assert::AreEqual(20, *actualSet.lower_bound(20));
+			Assert::AreEqual(30, *actualSet.upper_bound(20));
+			Assert::AreEqual(10, *actualSet.lower_bound(5));
+			Assert::IsTrue(actualSet.lower_bound(31) == actualSet.end());
+			Assert::IsTrue(actualSet.find(15) == actualSet.end());
+		}
+		TEST_METHOD(checkFromMap) {
+			bon::map<int, std::string> sourceMap({ {2, "two"}, {1, "one"} });
+
+			bon::flat_map<int, std::string> copiedMap(sourceMap);
+			Assert::AreEqual(2, copiedMap.size());
+			Assert::AreEqual(std::string("one"), copiedMap.begin()->second);
+
+			bon::flat_map<int, std::string> movedMap(std::move(sourceMap));
+			Assert::AreEqual(std::string("two"), movedMap.at(2));
+			Assert::IsTrue(sourceMap.empty());
+		}
+		TEST_METHOD(checkMapHeterogeneousFind) {
+			bon::flat_map<std::string, int, std::less<>> actualMap({ {"apple", 1}, {"banana", 2} });
+
+			Assert::AreEqual(2, actualMap.find("banana")->second);
+			Assert::IsTrue(actualMap.find("cherry") == actualMap.end());
+		}
+		TEST_METHOD(checkMapOperatorBracketInserts) {
+			bon::flat_map<std::string, int> actualMap;
+			for (const char *word : { "b", "a", "b", "c", "b" })
+				actualMap[word]++;
+
+			Assert::AreEqual(3, actualMap.size());
+			Assert::AreEqual(3, actualMap["b"]);
+			Assert::AreEqual(0, actualMap["0"]);
+			Assert::AreEqual(std::string("0"), actualMap.begin()->first);
+			Assert::AreEqual(4, actualMap.size());
+		}
+		TEST_METHOD(checkMapInsertOrAssign) {
+			bon::flat_map<int, std::string> actualMap({ {1, "one"} });
+
+			Assert::IsFalse(actualMap.insert_or_assign(1, std::string("uno")).second);
+			Assert::IsTrue(actualMap.insert_or_assign(0, std::string("zero")).second);
+			Assert::AreEqual(std::string("uno"), actualMap.at(1));
+			Assert::AreEqual(std::string("zero"), actualMap.begin()->second);
+		}
+		TEST_METHOD(checkMapAtMissingKey) {
+			bon::flat_map<int, int> actualMap({ {1, 10} });
+
+			try {
+				actualMap.at(2);
+				Assert::Fail();
+			}
+			catch (std::out_of_range *error) {
+				delete error;
+			}
+		}
+	};
+}
\ No newline at end of file
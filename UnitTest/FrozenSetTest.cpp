@@ -0,0 +1,60 @@
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "../DataStructure/frozen_set.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(FrozenSetTest) {
+	public:
+		TEST_METHOD(checkIterationIsSorted) {
+			std::vector<int> values({ 5, 3, 9, 1, 3, 7, 5 });
+			bon::frozen_set<int> actualSet(values.begin(), values.end());
+
+			std::vector<int> expected({ 1, 3, 5, 7, 9 });
+			Assert::AreEqual(static_cast<int>(expected.size()), actualSet.size());
+			Assert::IsTrue(std::equal(expected.begin(), expected.end(), actualSet.begin()));
+		}
+		TEST_METHOD(checkBoundsMatchSortedSearch) {
+			std::mt19937 random(7);
+
+			//   Ʈ ƴ ũ⵵ 
+			for (int count : { 0, 1, 2, 7, 8, 100, 1000 }) {
+				std::set<int> expected;
+				while (static_cast<int>(expected.size()) < count)
+					expected.insert(static_cast<int>(random() % (4 * count)));
+
+				bon::frozen_set<int> actualSet(bon::set<int>(expected.begin(), expected.end()));
+				Assert::AreEqual(count, actualSet.size());
+
+				for (int key = -1; key <= 4 * count; key++) {
+					auto expectedLower = expected.lower_bound(key);
+					auto actualLower = actualSet.lower_bound(key);
+					Assert::AreEqual(expectedLower == expected.end(), actualLower == actualSet.end());
+					if (expectedLower != expected.end())
+						Assert::AreEqual(*expectedLower, *actualLower);
+
+					auto expectedUpper = expected.upper_bound(key);
+					auto actualUpper = actualSet.upper_bound(key);
+					Assert::AreEqual(expectedUpper == expected.end(), actualUpper == actualSet.end());
+					if (expectedUpper != expected.end())
+						Assert::AreEqual(*expectedUpper, *actualUpper);
+
+					Assert::AreEqual(expected.count(key) > 0, actualSet.contains(key));
+				}
+			}
+		}
+		TEST_METHOD(checkTransparentLookup) {
+			std::vector<std::string> values({ "pear", "apple", "fig" });
+			bon::frozen_set<std::string, std::less<>> actualSet(values.begin(), values.end());
+
+			Assert::AreEqual(std::string("fig"), *actualSet.lower_bound("b"));
+			Assert::IsTrue(actualSet.find("kiwi") == actualSet.end());
+			Assert::IsTrue(actualSet.contains("pear"));
+		}
+	};
+}
\ No newline at end of file
@@ -45,6 +45,24 @@ namespace UnitTest {
 
 			AssertEqual(expectedList, actualList);
 		}
+		TEST_METHOD(checkMoveConstructor) {
+			bon::list<int> expectedList({ 1,2,3,4 });
+			bon::list<int> sourceList(expectedList);
+			bon::list<int> actualList(std::move(sourceList));
+
+			AssertEqual(expectedList, actualList);
+			Assert::IsTrue(sourceList.empty());
+		}
+		TEST_METHOD(checkMoveAssign) {
+			bon::list<int> expectedList({ 1,2,3,4 });
+			bon::list<int> sourceList(expectedList);
+			bon::list<int> actualList({ 5, 6 });
+
+			actualList = std::move(sourceList);
+
+			AssertEqual(expectedList, actualList);
+			Assert::IsTrue(sourceList.empty());
+		}
 
 		TEST_METHOD(checkAssignInitializerList) {
 			bon::list<int> actualList;
@@ -119,6 +137,16 @@ namespace UnitTest {
 			for (auto iter = actualList.begin(); iter != actualList.end(); iter++)
 				Assert::AreEqual(arr[i++], *iter);
 		}
+		TEST_METHOD(checkEmplaceBack) {
+			bon::list<std::string> actualList;
+
+			actualList.emplace_back(3, 'a');
+			actualList.emplace_front("b");
+
+			Assert::AreEqual(2, actualList.size());
+			Assert::AreEqual(std::string("b"), actualList.front());
+			Assert::AreEqual(std::string("aaa"), actualList.back());
+		}
 		TEST_METHOD(checkPopBack) {
 			bon::list<int> actualList;
 			int arr[] = { 1, 2, 3 };
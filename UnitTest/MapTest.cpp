@@ -0,0 +1,192 @@
+#include "CppUnitTest.h"
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include "../DataStructure/map.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(MapTest) {
+	public:
+		// (second)  ϴ ̵
+		class sumOfValues {
+		public:
+			using value_type = long long;
+
+			static long long identity() {
+				return 0;
+			}
+			static long long lift(const std::pair<int, int> &value) {
+				return value.second;
+			}
+			static long long combine(long long left, long long right) {
+				return left + right;
+			}
+		};
+		using summedMap = bon::map<int, int, std::less<int>, bon::pool_allocator<std::pair<int, int>>, bon::monoid_augment<sumOfValues>>;
+
+		// ⺻ ڰ   Ÿ
+		class NoDefault {
+		public:
+			explicit NoDefault(int value) : value(value) {
+			}
+
+			int value;
+		};
+
+		TEST_METHOD(checkFind) {
+			bon::map<int, int> actualMap({ {1, 10}, {2, 20}, {3, 30} });
+
+			Assert::AreEqual(20, actualMap.find(2)->second);
+			Assert::IsTrue(actualMap.find(4) == actualMap.end());
+			Assert::AreEqual(2, actualMap.lower_bound(2)->first);
+			Assert::AreEqual(3, actualMap.upper_bound(2)->first);
+			Assert::IsTrue(actualMap.upper_bound(3) == actualMap.end());
+		}
+		TEST_METHOD(checkFindWithoutDefaultConstructor) {
+			bon::map<int, NoDefault> actualMap;
+			actualMap.insert(std::make_pair(1, NoDefault(10)));
+			actualMap.insert(std::make_pair(2, NoDefault(20)));
+
+			Assert::AreEqual(20, actualMap.find(2)->second.value);
+			Assert::AreEqual(10, actualMap.at(1).value);
+			Assert::IsTrue(actualMap.find(3) == actualMap.end());
+		}
+		TEST_METHOD(checkHeterogeneousFind) {
+			bon::map<std::string, int, std::less<>> actualMap({ {"apple", 1}, {"banana", 2}, {"cherry", 3} });
+
+			const char *key = "banana";
+			Assert::AreEqual(2, actualMap.find(key)->second);
+			Assert::IsTrue(actualMap.find("durian") == actualMap.end());
+			Assert::AreEqual(3, actualMap.upper_bound("banana")->second);
+			Assert::AreEqual(1, actualMap.lower_bound("a")->second);
+		}
+		TEST_METHOD(checkKeyComparator) {
+			// pair ϴ   ڴ map    (static_assert)
+			struct pairGreater {
+				bool operator()(const std::pair<int, int> &left, const std::pair<int, int> &right) const {
+					return left.first > right.first;
+				}
+			};
+			Assert::IsFalse(bon::IsKeyCompare<pairGreater, int>::value);
+			Assert::IsTrue(bon::IsKeyCompare<std::greater<int>, int>::value);
+
+			bon::map<int, int, std::greater<int>> actualMap({ {1, 10}, {3, 30}, {2, 20} });
+			Assert::AreEqual(3, actualMap.begin()->first);
+			Assert::AreEqual(20, actualMap.find(2)->second);
+		}
+		TEST_METHOD(checkMoveConstructor) {
+			bon::map<int, std::string> sourceMap({ {2, "two"}, {1, "one"} });
+			bon::map<int, std::string> actualMap(std::move(sourceMap));
+
+			Assert::AreEqual(2, actualMap.size());
+			Assert::AreEqual(std::string("one"), actualMap.at(1));
+			Assert::IsTrue(sourceMap.empty());
+
+			// Ű ʰ       ־ 
+			actualMap.insert(std::make_pair(3, std::string("three")));
+			sourceMap.insert(std::make_pair(4, std::string("four")));
+			Assert::AreEqual(3, actualMap.size());
+			Assert::AreEqual(1, sourceMap.size());
+		}
+		TEST_METHOD(checkMoveAssign) {
+			bon::map<int, std::string> sourceMap({ {1, "one"}, {2, "two"} });
+			bon::map<int, std::string> actualMap({ {3, "three"} });
+
+			actualMap = std::move(sourceMap);
+			Assert::AreEqual(2, actualMap.size());
+			Assert::AreEqual(std::string("two"), actualMap.at(2));
+			Assert::IsTrue(actualMap.find(3) == actualMap.end());
+			Assert::IsTrue(sourceMap.empty());
+
+			// ڱ ڽſ Űܵ ״
+			bon::map<int, std::string> &sameMap = actualMap;
+			actualMap = std::move(sameMap);
+			Assert::AreEqual(2, actualMap.size());
+			Assert::AreEqual(std::string("one"), actualMap.at(1));
+		}
+		TEST_METHOD(checkEmplace) {
+			bon::map<int, std::string> actualMap;
+
+			actualMap.emplace(1, "one");
+			actualMap.emplace(std::piecewise_construct, std::forward_as_tuple(2), std::forward_as_tuple(3, 'b'));
+			actualMap.emplace(1, "uno"); // ̹ ִ Ű 
+
+			Assert::AreEqual(2, actualMap.size());
+			Assert::AreEqual(std::string("one"), actualMap.at(1));
+			Assert::AreEqual(std::string("bbb"), actualMap.at(2));
+		}
+		TEST_METHOD(checkEraseMissingKey) {
+			bon::map<int, int> actualMap({ {1, 10}, {2, 20} });
+
+			actualMap.erase(3);
+			Assert::AreEqual(2, actualMap.size());
+
+			actualMap.erase(1);
+			Assert::AreEqual(1, actualMap.size());
+			Assert::IsTrue(actualMap.find(1) == actualMap.end());
+		}
+		TEST_METHOD(checkOperatorBracketInserts) {
+			bon::map<std::string, int> actualMap;
+			for (const char *word : { "a", "b", "a", "c", "a" })
+				actualMap[word]++;
+
+			Assert::AreEqual(3, actualMap.size());
+			Assert::AreEqual(3, actualMap["a"]);
+			Assert::AreEqual(1, actualMap["c"]);
+			Assert::AreEqual(0, actualMap["d"]);
+			Assert::AreEqual(4, actualMap.size());
+		}
+		TEST_METHOD(checkTryEmplace) {
+			bon::map<int, std::unique_ptr<int>> actualMap;
+			std::unique_ptr<int> value(new int(10));
+
+			Assert::IsTrue(actualMap.try_emplace(1, std::move(value)).second);
+			Assert::IsTrue(value == nullptr);
+
+			// Ű  ڸ ű 
+			value.reset(new int(20));
+			auto result = actualMap.try_emplace(1, std::move(value));
+			Assert::IsFalse(result.second);
+			Assert::AreEqual(10, *result.first->second);
+			Assert::IsTrue(value != nullptr);
+		}
+		TEST_METHOD(checkInsertOrAssign) {
+			bon::map<int, std::string> actualMap({ {1, "one"} });
+
+			Assert::IsTrue(actualMap.insert_or_assign(2, "two").second);
+			Assert::IsFalse(actualMap.insert_or_assign(1, "uno").second);
+			Assert::AreEqual(std::string("uno"), actualMap.at(1));
+			Assert::AreEqual(std::string("two"), actualMap.at(2));
+			Assert::AreEqual(2, actualMap.size());
+		}
+		TEST_METHOD(checkAtMissingKey) {
+			bon::map<int, int> actualMap({ {1, 10} });
+
+			try {
+				actualMap.at(2);
+				Assert::Fail();
+			}
+			catch (std::out_of_range *error) {
+				delete error;
+			}
+		}
+		TEST_METHOD(checkAggregate) {
+			summedMap actualMap;
+			for (int i = 0; i < 100; i++)
+				actualMap.insert(std::make_pair(i, i * 10));
+
+			Assert::AreEqual(49500LL, actualMap.aggregate());
+			Assert::AreEqual(1450LL, actualMap.aggregate(10, 20));
+			Assert::AreEqual(0LL, actualMap.aggregate(20, 20));
+			Assert::AreEqual(0LL, actualMap.aggregate(200, 300));
+
+			for (int i = 10; i < 20; i += 2)
+				actualMap.erase(i);
+			Assert::AreEqual(750LL, actualMap.aggregate(10, 20));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "CppUnitTest.h"
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include "../DataStructure/persistent_map.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(PersistentMapTest) {
+	public:
+		template <typename K, typename V>
+		static void AssertEqual(const std::map<K, V> &expected, const bon::persistent_map<K, V> &actual) {
+			Assert::AreEqual(static_cast<int>(expected.size()), actual.size());
+			auto actualIter = actual.begin();
+			for (auto expectedIter = expected.begin(); expectedIter != expected.end(); expectedIter++, actualIter++) {
+				Assert::AreEqual(expectedIter->first, actualIter->first);
+				Assert::AreEqual(expectedIter->second, actualIter->second);
+			}
+			Assert::IsTrue(actualIter == actual.end());
+		}
+
+		TEST_METHOD(checkInsertAndErase) {
+			bon::persistent_map<int, int> actualMap({ {3, 30}, {1, 10}, {2, 20} });
+
+			Assert::IsFalse(actualMap.insert({ 2, 0 }));
+			Assert::IsFalse(actualMap.insert_or_assign(2, 200));
+			Assert::AreEqual(1, actualMap.erase(1));
+			Assert::AreEqual(0, actualMap.erase(1));
+			AssertEqual(std::map<int, int>({ {2, 200}, {3, 30} }), actualMap);
+		}
+		TEST_METHOD(checkSnapshotIsUnchanged) {
+			bon::persistent_map<int, int> actualMap;
+			std::map<int, int> expectedMap;
+			for (int i = 0; i < 1000; i++) {
+				actualMap.insert({ i, i });
+				expectedMap.emplace(i, i);
+			}
+
+			auto snapshot = actualMap.snapshot();
+			for (int i = 0; i < 1000; i += 2)
+				actualMap.erase(i);
+			for (int i = 1000; i < 1500; i++)
+				actualMap.insert({ i, i });
+			actualMap.insert_or_assign(1, -1);
+
+			AssertEqual(expectedMap, snapshot);
+			Assert::AreEqual(1000, actualMap.size());
+			Assert::AreEqual(-1, actualMap.at(1));
+			Assert::AreEqual(1, snapshot.at(1));
+		}
+		TEST_METHOD(checkBounds) {
+			bon::persistent_map<int, int> actualMap({ {10, 1}, {20, 2}, {30, 3} });
+
+			Assert::AreEqual(20, actualMap.lower_bound(20)->first);
+			Assert::AreEqual(30, actualMap.upper_bound(20)->first);
+			Assert::IsTrue(actualMap.lower_bound(31) == actualMap.end());
+			Assert::IsTrue(actualMap.find(15) == actualMap.end());
+			Assert::IsTrue(actualMap.contains(30));
+		}
+		TEST_METHOD(checkAtMissingKey) {
+			bon::persistent_map<int, int> actualMap({ {1, 10} });
+
+			try {
+				actualMap.at(2);
+				Assert::Fail();
+			}
+			catch (std::out_of_range *error) {
+				delete error;
+			}
+		}
+		//     ̻  ʴ  Ǿ 
+		TEST_METHOD(checkUnreachableNodesReleased) {
+			std::shared_ptr<int> tracked = std::make_shared<int>(1);
+			{
+				bon::persistent_map<int, std::shared_ptr<int>> actualMap;
+				for (int i = 0; i < 100; i++)
+					actualMap.insert({ i, tracked });
+
+				auto snapshot = actualMap.snapshot();
+				for (int i = 0; i < 100; i++)
+					actualMap.erase(i);
+				Assert::AreEqual(101, static_cast<int>(tracked.use_count()));
+
+				snapshot.clear();
+				Assert::AreEqual(1, static_cast<int>(tracked.use_count()));
+			}
+
+			Assert::AreEqual(1, static_cast<int>(tracked.use_count()));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include "CppUnitTest.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include "../DataStructure/pool_allocator.hpp"
+#include "../DataStructure/set.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(PoolAllocatorTest) {
+	public:
+		// Ʈ ó  ũ  䱸 ִ Ÿ
+		struct wideNode {
+			wideNode *left, *right;
+			double value;
+		};
+
+		static void AssertEqual(int first, int last, const bon::set<std::string> &actual) {
+			Assert::AreEqual(last - first, actual.size());
+			auto actualIter = actual.begin();
+			for (int i = first; i < last; i++, actualIter++)
+				Assert::AreEqual(Key(i), *actualIter);
+		}
+		static std::string Key(int i) {
+			//  ڿ ȭ ѱ ̷   Ҹ  ʿϵ 
+			std::string key = std::to_string(i);
+			return std::string(20 - key.size(), '0') + key;
+		}
+
+		TEST_METHOD(checkFreedSlotReused) {
+			bon::pool_allocator<int> allocator;
+			int *first = allocator.allocate(1);
+			int *second = allocator.allocate(1);
+
+			allocator.deallocate(first, 1);
+			Assert::IsTrue(allocator.allocate(1) == first);
+
+			allocator.deallocate(second, 1);
+			allocator.deallocate(first, 1);
+		}
+		TEST_METHOD(checkReleaseAfterClear) {
+			bon::set<std::string> actualSet;
+			// ûũ ϳ(256) Ѱ  ûũ   ȯϵ 
+			for (int i = 0; i < 1000; i++)
+				actualSet.insert(Key(i));
+
+			actualSet.clear();
+			Assert::IsTrue(actualSet.empty());
+
+			for (int i = 500; i < 600; i++)
+				actualSet.insert(Key(i));
+			AssertEqual(500, 600, actualSet);
+		}
+		TEST_METHOD(checkCopyHasOwnPool) {
+			bon::pool_allocator<int> allocator;
+			bon::pool_allocator<int> copied(allocator);
+			Assert::IsTrue(allocator != copied);
+
+			std::unique_ptr<bon::set<std::string>> sourceSet(new bon::set<std::string>());
+			for (int i = 0; i < 300; i++)
+				sourceSet->insert(Key(i));
+
+			bon::set<std::string> copiedSet(*sourceSet);
+			sourceSet.reset(); //  ûũ ȯص 纻 ״
+
+			copiedSet.insert(Key(300));
+			AssertEqual(0, 301, copiedSet);
+		}
+		TEST_METHOD(checkMoveAssignTakesPool) {
+			Assert::IsTrue(std::allocator_traits<bon::pool_allocator<int>>::propagate_on_container_move_assignment::value);
+
+			bon::pool_allocator<int> source;
+			int *target = source.allocate(1);
+			*target = 10;
+
+			bon::pool_allocator<int> actual;
+			actual = std::move(source);
+			Assert::AreEqual(10, *target);
+
+			// Ű  Ǯ ϰ ٽ Ҵ
+			actual.deallocate(target, 1);
+			Assert::IsTrue(actual.allocate(1) == target);
+			actual.deallocate(target, 1);
+		}
+		TEST_METHOD(checkSpliceTakesChunks) {
+			bon::pool_allocator<int> source;
+			int *target = source.allocate(1);
+			int *freed = source.allocate(1);
+			*target = 10;
+			source.deallocate(freed, 1);
+
+			bon::pool_allocator<int> actual;
+			int *own = actual.allocate(1);
+			actual.splice(source);
+			Assert::AreEqual(0, static_cast<int>(source.capacity()));
+			Assert::AreEqual(512, static_cast<int>(actual.capacity()));
+
+			// Ѱܹ    , Ѱܹ 嵵  Ǯ 
+			Assert::IsTrue(actual.allocate(1) == freed);
+			Assert::AreEqual(10, *target);
+			actual.deallocate(target, 1);
+			actual.deallocate(freed, 1);
+			actual.deallocate(own, 1);
+		}
+		TEST_METHOD(checkUnionKeepsPoolBounded) {
+			struct pooledSet : bon::set<std::string> {
+				int capacity() const {
+					return static_cast<int>(nodeAllocator.capacity());
+				}
+			};
+
+			//    ĵ   ûũ  ʾƾ 
+			pooledSet actualSet;
+			for (int i = 0; i < 500; i++)
+				actualSet.insert(Key(i));
+			int capacity = actualSet.capacity();
+
+			for (int i = 0; i < 2000; i++) {
+				bon::set<std::string> smallSet;
+				for (int j = 0; j < 10; j++)
+					smallSet.insert(Key((i * 10 + j) % 500));
+				actualSet.set_union(std::move(smallSet));
+			}
+			AssertEqual(0, 500, actualSet);
+			Assert::AreEqual(capacity, actualSet.capacity());
+
+			//  ū հ ġ  Ǯ ٲǷ Ǯ ū  ϳ ũ 
+			for (int i = 0; i < 100; i++) {
+				bon::set<std::string> largeSet;
+				for (int j = 0; j < 501; j++)
+					largeSet.insert(Key(j));
+				actualSet.set_union(std::move(largeSet));
+			}
+			AssertEqual(0, 501, actualSet);
+			Assert::IsTrue(actualSet.capacity() <= 4 * capacity);
+		}
+		TEST_METHOD(checkRebindToNode) {
+			using nodeAllocator = std::allocator_traits<bon::pool_allocator<int>>::rebind_alloc<wideNode>;
+			Assert::IsTrue(std::is_same<bon::pool_allocator<wideNode>, nodeAllocator>::value);
+
+			bon::pool_allocator<int> allocator;
+			nodeAllocator rebound(allocator);
+			for (int i = 0; i < 300; i++) {
+				wideNode *target = rebound.allocate(1);
+				Assert::IsTrue(reinterpret_cast<std::uintptr_t>(target) % alignof(wideNode) == 0);
+				target->value = i;
+			}
+			rebound.release();
+		}
+		TEST_METHOD(checkSplitSharesPool) {
+			std::unique_ptr<bon::set<std::string>> sourceSet(new bon::set<std::string>());
+			for (int i = 0; i < 1000; i++)
+				sourceSet->insert(Key(i));
+
+			//     Ǯ ûũ Ƿ    ־ 
+			bon::set<std::string> rightSet = sourceSet->split(Key(400));
+			sourceSet.reset();
+
+			rightSet.erase(Key(999));
+			rightSet.insert(Key(999));
+			AssertEqual(400, 1000, rightSet);
+
+			bon::set<std::string> leftSet;
+			for (int i = 0; i < 400; i++)
+				leftSet.insert(Key(i));
+			leftSet.join(std::move(rightSet));
+			Assert::IsTrue(rightSet.empty());
+			AssertEqual(0, 1000, leftSet);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "CppUnitTest.h"
+#include <string>
+#include "../DataStructure/list.hpp"
+#include "../DataStructure/queue.hpp"
+#include "../DataStructure/ring_buffer.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(RingBufferTest) {
+	public:
+		template <class Queue>
+		static void checkQueue() {
+			Queue actualQueue;
+			for (int i = 0; i < 100; i++)
+				actualQueue.push(i);
+			actualQueue.emplace(100);
+
+			Assert::AreEqual(101, actualQueue.size());
+			Assert::AreEqual(100, actualQueue.back());
+			for (int i = 0; i <= 100; i++) {
+				Assert::AreEqual(i, actualQueue.front());
+				actualQueue.pop();
+			}
+			Assert::IsTrue(actualQueue.empty());
+		}
+
+		TEST_METHOD(checkWrapAroundBeforeGrow) {
+			bon::ring_buffer<int> actualBuffer;
+			actualBuffer.reserve(16);
+
+			// head 뷮  ó ű   ä Ұ    
+			for (int i = 0; i < 10; i++) {
+				actualBuffer.push_back(i);
+				actualBuffer.pop_front();
+			}
+			for (int i = 0; i < 16; i++)
+				actualBuffer.push_back(i);
+			//  ¿ Ȯ
+			actualBuffer.push_back(16);
+
+			Assert::AreEqual(17, actualBuffer.size());
+			for (int i = 0; i < 17; i++)
+				Assert::AreEqual(i, actualBuffer[i]);
+			Assert::AreEqual(0, actualBuffer.front());
+			Assert::AreEqual(16, actualBuffer.back());
+		}
+		TEST_METHOD(checkEmplaceSelfReferenceWhenFull) {
+			bon::ring_buffer<std::string> actualBuffer;
+			actualBuffer.reserve(16);
+			for (int i = 0; i < 16; i++)
+				actualBuffer.push_back(std::string(32, static_cast<char>('a' + i)));
+
+			// ڰ Ȯ Ű Ҹ Ŵ
+			actualBuffer.emplace_back(actualBuffer[0]);
+			Assert::AreEqual(17, actualBuffer.size());
+			Assert::AreEqual(std::string(32, 'a'), actualBuffer.back());
+
+			while (actualBuffer.size() < 32)
+				actualBuffer.push_back("filler");
+			actualBuffer.emplace_front(actualBuffer[1]);
+			Assert::AreEqual(33, actualBuffer.size());
+			Assert::AreEqual(std::string(32, 'b'), actualBuffer.front());
+		}
+		TEST_METHOD(checkReserveNonPowerOfTwo) {
+			bon::ring_buffer<int> actualBuffer;
+			actualBuffer.reserve(100);
+
+			// 뷮 2 ŵ øǹǷ ε ¾ƾ 
+			for (int i = 0; i < 50; i++)
+				actualBuffer.push_front(i);
+			for (int i = 50; i < 100; i++)
+				actualBuffer.push_back(i);
+
+			Assert::AreEqual(100, actualBuffer.size());
+			Assert::AreEqual(49, actualBuffer[0]);
+			Assert::AreEqual(0, actualBuffer[49]);
+			Assert::AreEqual(99, actualBuffer[99]);
+		}
+		TEST_METHOD(checkClear) {
+			bon::ring_buffer<std::string> actualBuffer;
+			for (int i = 0; i < 20; i++)
+				actualBuffer.push_back(std::to_string(i));
+
+			actualBuffer.clear();
+			Assert::IsTrue(actualBuffer.empty());
+
+			actualBuffer.push_back("next");
+			Assert::AreEqual(1, actualBuffer.size());
+			Assert::AreEqual(std::string("next"), actualBuffer.front());
+		}
+		TEST_METHOD(checkQueueWithDefaultContainer) {
+			checkQueue<bon::queue<int>>();
+		}
+		TEST_METHOD(checkQueueWithList) {
+			checkQueue<bon::queue<int, bon::list<int>>>();
+		}
+	};
+}
\ No newline at end of file
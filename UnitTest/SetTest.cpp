@@ -0,0 +1,238 @@
+#include "CppUnitTest.h"
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../DataStructure/set.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(SetTest) {
+	public:
+		using rankedSet = bon::set<int, std::less<int>, bon::pool_allocator<int>, bon::order_statistic>;
+
+		static void AssertEqual(std::initializer_list<int> expected, const bon::set<int> &actual) {
+			Assert::AreEqual(static_cast<int>(expected.size()), actual.size());
+			auto actualIter = actual.begin();
+			for (auto expectedIter = expected.begin(); expectedIter != expected.end(); expectedIter++, actualIter++)
+				Assert::AreEqual(*expectedIter, *actualIter);
+		}
+
+		TEST_METHOD(checkNth) {
+			rankedSet actualSet({ 50, 10, 40, 20, 30 });
+
+			for (int i = 0; i < 5; i++)
+				Assert::AreEqual((i + 1) * 10, *actualSet.nth(i));
+			Assert::IsTrue(actualSet.nth(5) == actualSet.end());
+			Assert::IsTrue(actualSet.nth(-1) == actualSet.end());
+		}
+		TEST_METHOD(checkRank) {
+			rankedSet actualSet({ 10, 20, 30, 40, 50 });
+
+			Assert::AreEqual(0, actualSet.rank(5));
+			Assert::AreEqual(2, actualSet.rank(30));
+			Assert::AreEqual(3, actualSet.rank(35));
+			Assert::AreEqual(5, actualSet.rank(100));
+		}
+		TEST_METHOD(checkRankAfterErase) {
+			rankedSet actualSet;
+			for (int i = 0; i < 1000; i++)
+				actualSet.insert(i);
+			for (int i = 0; i < 1000; i += 2)
+				actualSet.erase(i);
+
+			for (int i = 0; i < 500; i++) {
+				Assert::AreEqual(i * 2 + 1, *actualSet.nth(i));
+				Assert::AreEqual(i, actualSet.rank(i * 2 + 1));
+			}
+		}
+		TEST_METHOD(checkEraseInnerNode) {
+			rankedSet actualSet;
+			for (int i = 0; i < 100; i++)
+				actualSet.insert(i);
+
+			// Ʈ ó  ڽ ̹Ƿ ļ 尡  ڸ Ű
+			for (int i = 0; i < 100; i += 3) {
+				auto iter = actualSet.erase(actualSet.find(i));
+				if (i + 1 < 100)
+					Assert::AreEqual(i + 1, *iter);
+			}
+
+			int expected = 1;
+			for (int i = 0; i < actualSet.size(); i++) {
+				Assert::AreEqual(expected, *actualSet.nth(i));
+				Assert::AreEqual(i, actualSet.rank(expected));
+				expected += (expected % 3 == 2) ? 2 : 1;
+			}
+		}
+		TEST_METHOD(checkDistance) {
+			rankedSet actualSet({ 10, 20, 30, 40, 50 });
+
+			Assert::AreEqual(5, static_cast<int>(std::distance(actualSet.begin(), actualSet.end())));
+			Assert::AreEqual(2, static_cast<int>(actualSet.find(40) - actualSet.find(20)));
+			Assert::AreEqual(30, *(actualSet.begin() + 2));
+			Assert::AreEqual(40, *(actualSet.end() - 2));
+			Assert::AreEqual(20, actualSet.begin()[1]);
+		}
+		TEST_METHOD(checkSplit) {
+			bon::set<int> actualSet({ 1, 2, 3, 4, 5, 6 });
+
+			bon::set<int> upperSet = actualSet.split(4);
+			AssertEqual({ 1, 2, 3 }, actualSet);
+			AssertEqual({ 4, 5, 6 }, upperSet);
+		}
+		TEST_METHOD(checkSizeAfterSplit) {
+			//  Ŀ ũ  ū Ұ ٷ ¾ƾ  (Ʈ ũⰡ  Ʈ)
+			for (int key : { 0, 1, 37, 99, 100 }) {
+				bon::set<int> lowerSet;
+				for (int i = 0; i < 100; i++)
+					lowerSet.insert(i);
+
+				bon::set<int> upperSet = lowerSet.split(key);
+				Assert::AreEqual(key, lowerSet.size());
+				Assert::AreEqual(100 - key, upperSet.size());
+
+				//  hint   ū  ڿ 
+				lowerSet.insert(lowerSet.end(), 1000);
+				upperSet.insert(upperSet.end(), 1000);
+				Assert::AreEqual(key + 1, lowerSet.size());
+				Assert::AreEqual(101 - key, upperSet.size());
+
+				//  ū Ҹ  ڿ ̾   ־ 
+				lowerSet.erase(1000);
+				lowerSet.join(std::move(upperSet));
+				Assert::AreEqual(101, lowerSet.size());
+				Assert::AreEqual(1000, *--lowerSet.end());
+			}
+		}
+		TEST_METHOD(checkJoin) {
+			bon::set<int> actualSet({ 1, 2, 3 });
+			bon::set<int> upperSet({ 4, 5, 6 });
+
+			actualSet.join(std::move(upperSet));
+			AssertEqual({ 1, 2, 3, 4, 5, 6 }, actualSet);
+			Assert::IsTrue(upperSet.empty());
+		}
+		TEST_METHOD(checkJoinOverlapping) {
+			bon::set<int> actualSet({ 1, 2, 3 });
+			bon::set<int> overlappingSet({ 3, 4 });
+
+			try {
+				actualSet.join(std::move(overlappingSet));
+				Assert::Fail();
+			}
+			catch (std::runtime_error *error) {
+				delete error;
+			}
+			AssertEqual({ 1, 2, 3 }, actualSet);
+		}
+		TEST_METHOD(checkSetOperations) {
+			bon::set<int> unionSet({ 1, 3, 5, 7 });
+			unionSet.set_union(bon::set<int>({ 2, 3, 4 }));
+			AssertEqual({ 1, 2, 3, 4, 5, 7 }, unionSet);
+
+			bon::set<int> intersectionSet({ 1, 3, 5, 7 });
+			intersectionSet.set_intersection(bon::set<int>({ 3, 4, 5 }));
+			AssertEqual({ 3, 5 }, intersectionSet);
+
+			bon::set<int> differenceSet({ 1, 3, 5, 7 });
+			differenceSet.set_difference(bon::set<int>({ 3, 4, 5 }));
+			AssertEqual({ 1, 7 }, differenceSet);
+		}
+		TEST_METHOD(checkInsertWithHint) {
+			bon::set<int> actualSet({ 10, 20, 30 });
+
+			Assert::AreEqual(40, *actualSet.insert(actualSet.end(), 40));
+			Assert::AreEqual(15, *actualSet.insert(actualSet.find(20), 15));
+			//  ʴ hint ϰ ڸ 
+			Assert::AreEqual(25, *actualSet.emplace_hint(actualSet.begin(), 25));
+			// ̹   Ҹ ȯ
+			Assert::AreEqual(20, *actualSet.insert(actualSet.find(30), 20));
+			AssertEqual({ 10, 15, 20, 25, 30, 40 }, actualSet);
+			Assert::AreEqual(40, *--actualSet.end());
+		}
+		TEST_METHOD(checkParallelConstruct) {
+			bon::thread_pool pool(4);
+			std::vector<int> values;
+			for (int i = 0; i < 100000; i++)
+				values.push_back((i * 7919) % 50000);
+
+			bon::set<int> actualSet(bon::parallel_t(pool), values.begin(), values.end());
+			Assert::AreEqual(50000, actualSet.size());
+
+			int expected = 0;
+			for (int value : actualSet)
+				Assert::AreEqual(expected++, value);
+		}
+		TEST_METHOD(checkParallelSetOperations) {
+			bon::thread_pool pool(4);
+			std::vector<int> evens, triples;
+			for (int i = 0; i < 200000; i += 2)
+				evens.push_back(i);
+			for (int i = 0; i < 200000; i += 3)
+				triples.push_back(i);
+
+			bon::set<int> unionSet(evens.begin(), evens.end());
+			unionSet.set_union(bon::parallel_t(pool), bon::set<int>(triples.begin(), triples.end()));
+			Assert::AreEqual(100000 + 66667 - 33334, unionSet.size());
+
+			bon::set<int> intersectionSet(evens.begin(), evens.end());
+			intersectionSet.set_intersection(bon::parallel_t(pool), bon::set<int>(triples.begin(), triples.end()));
+			Assert::AreEqual(33334, intersectionSet.size());
+			for (int value : intersectionSet)
+				Assert::AreEqual(0, value % 6);
+
+			bon::set<int> differenceSet(evens.begin(), evens.end());
+			differenceSet.set_difference(bon::parallel_t(pool), bon::set<int>(triples.begin(), triples.end()));
+			Assert::AreEqual(100000 - 33334, differenceSet.size());
+
+			differenceSet.clear(bon::parallel_t(pool));
+			Assert::IsTrue(differenceSet.empty());
+		}
+		TEST_METHOD(checkMoveConstructor) {
+			bon::set<int> sourceSet({ 3, 1, 4, 2 });
+			bon::set<int> actualSet(std::move(sourceSet));
+
+			AssertEqual({ 1, 2, 3, 4 }, actualSet);
+			Assert::IsTrue(sourceSet.empty());
+
+			// Ű ʰ       ־ 
+			actualSet.insert(5);
+			sourceSet.insert(10);
+			AssertEqual({ 1, 2, 3, 4, 5 }, actualSet);
+			AssertEqual({ 10 }, sourceSet);
+		}
+		TEST_METHOD(checkMoveAssign) {
+			bon::set<int> sourceSet({ 1, 2, 3, 4 });
+			bon::set<int> actualSet({ 5, 6 });
+
+			actualSet = std::move(sourceSet);
+			AssertEqual({ 1, 2, 3, 4 }, actualSet);
+			Assert::IsTrue(sourceSet.empty());
+
+			actualSet.erase(2);
+			sourceSet.insert(7);
+			AssertEqual({ 1, 3, 4 }, actualSet);
+			AssertEqual({ 7 }, sourceSet);
+		}
+		TEST_METHOD(checkSelfMoveAssign) {
+			bon::set<int> actualSet({ 1, 2, 3 });
+			bon::set<int> &sameSet = actualSet;
+
+			actualSet = std::move(sameSet);
+			AssertEqual({ 1, 2, 3 }, actualSet);
+		}
+		TEST_METHOD(checkEmplace) {
+			bon::set<std::string> actualSet;
+
+			actualSet.emplace(3, 'a');
+			actualSet.emplace("b");
+			actualSet.emplace("aaa"); // ̹ ִ  
+
+			Assert::AreEqual(2, actualSet.size());
+			Assert::AreEqual(std::string("aaa"), *actualSet.begin());
+			Assert::AreEqual(std::string("b"), *--actualSet.end());
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include "CppUnitTest.h"
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include "../DataStructure/thread_pool.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(ThreadPoolTest) {
+	public:
+		TEST_METHOD(checkInvokeRunsBoth) {
+			bon::thread_pool pool(2);
+			int left = 0, right = 0;
+
+			pool.invoke([&] { left = 1; }, [&] { right = 2; });
+			Assert::AreEqual(1, left);
+			Assert::AreEqual(2, right);
+		}
+		TEST_METHOD(checkNestedInvoke) {
+			bon::thread_pool pool(4);
+
+			Assert::AreEqual(static_cast<long long>(1 << 16) * ((1 << 16) - 1) / 2, Sum(pool, 0, 1 << 16));
+		}
+		TEST_METHOD(checkInvokeRethrows) {
+			bon::thread_pool pool(2);
+			bool bRightDone = false;
+			auto func = [&] {
+				pool.invoke([] { throw std::logic_error("left"); }, [&] { bRightDone = true; });
+			};
+
+			Assert::ExpectException<std::logic_error>(func);
+			Assert::IsTrue(bRightDone);
+		}
+		TEST_METHOD(checkWakeAfterIdle) {
+			bon::thread_pool pool(2);
+
+			// ۾ڰ   ڿ  ۾ ˸ ޾ Ǿ  (ð   ٸ)
+			for (int i = 0; i < 20; i++) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+				int result = 0;
+				pool.run([&] { result = i; });
+				Assert::AreEqual(i, result);
+			}
+		}
+
+	private:
+		static long long Sum(bon::thread_pool &pool, int begin, int end) {
+			if (end - begin <= 1024) {
+				long long sum = 0;
+				for (int i = begin; i < end; i++)
+					sum += i;
+				return sum;
+			}
+
+			int middle = begin + (end - begin) / 2;
+			long long left = 0, right = 0;
+			pool.invoke([&] { left = Sum(pool, begin, middle); }, [&] { right = Sum(pool, middle, end); });
+			return left + right;
+		}
+	};
+}
\ No newline at end of file
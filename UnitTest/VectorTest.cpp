@@ -0,0 +1,82 @@
+#include "CppUnitTest.h"
+#include <string>
+#include "../DataStructure/list.hpp"
+#include "../DataStructure/stack.hpp"
+#include "../DataStructure/vector.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest {
+	TEST_CLASS(VectorTest) {
+	public:
+		template <class Stack>
+		static void checkStack() {
+			Stack actualStack;
+			for (int i = 0; i < 100; i++)
+				actualStack.push(i);
+			actualStack.emplace(100);
+
+			Assert::AreEqual(101, actualStack.size());
+			for (int i = 100; i >= 0; i--) {
+				Assert::AreEqual(i, actualStack.top());
+				actualStack.pop();
+			}
+			Assert::IsTrue(actualStack.empty());
+		}
+
+		TEST_METHOD(checkPushBackPastCapacity) {
+			bon::vector<int> actualVector;
+			for (int i = 0; i < 100; i++)
+				actualVector.push_back(i);
+
+			Assert::AreEqual(100, actualVector.size());
+			for (int i = 0; i < 100; i++)
+				Assert::AreEqual(i, actualVector[i]);
+			Assert::AreEqual(99, actualVector.back());
+		}
+		TEST_METHOD(checkEmplaceSelfReferenceWhenFull) {
+			bon::vector<std::string> actualVector;
+			actualVector.reserve(16);
+			for (int i = 0; i < 16; i++)
+				actualVector.push_back(std::string(32, static_cast<char>('a' + i)));
+
+			// ڰ Ȯ Ű Ҹ Ŵ
+			actualVector.emplace_back(actualVector[0]);
+
+			Assert::AreEqual(17, actualVector.size());
+			Assert::AreEqual(std::string(32, 'a'), actualVector.back());
+		}
+		TEST_METHOD(checkReserveNonPowerOfTwo) {
+			bon::vector<int> actualVector;
+			actualVector.reserve(100);
+			for (int i = 0; i < 101; i++)
+				actualVector.push_back(i);
+
+			Assert::AreEqual(101, actualVector.size());
+			Assert::AreEqual(100, actualVector[100]);
+		}
+		TEST_METHOD(checkClear) {
+			bon::vector<std::string> actualVector({ "a", "b", "c" });
+
+			actualVector.clear();
+			Assert::IsTrue(actualVector.empty());
+
+			actualVector.push_back("next");
+			Assert::AreEqual(1, actualVector.size());
+			Assert::AreEqual(std::string("next"), actualVector.front());
+		}
+		TEST_METHOD(checkMoveConstructor) {
+			bon::vector<int> sourceVector({ 1, 2, 3 });
+			bon::vector<int> actualVector(std::move(sourceVector));
+
+			Assert::AreEqual(3, actualVector.size());
+			Assert::IsTrue(sourceVector.empty());
+		}
+		TEST_METHOD(checkStackWithDefaultContainer) {
+			checkStack<bon::stack<int>>();
+		}
+		TEST_METHOD(checkStackWithList) {
+			checkStack<bon::stack<int, bon::list<int>>>();
+		}
+	};
+}
\ No newline at end of file